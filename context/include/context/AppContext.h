@@ -16,6 +16,7 @@ namespace daq {
 }
 
 class UpdateScheduler;
+class FrameClock;
 class EventQueue;
 
 // Global application context - singleton for accessing openDAQ instance
@@ -55,6 +56,9 @@ public:
     // Update scheduler for periodic widget updates
     UpdateScheduler* updateScheduler() const;
 
+    // Frame clock that paces live views
+    FrameClock* frameClock() const;
+
     EventQueue* eventQueue() const;
     static EventQueue* DaqEvent();
 
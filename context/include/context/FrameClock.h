@@ -0,0 +1,71 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QPointer>
+#include <QList>
+#include <QElapsedTimer>
+
+// Constants for frame pacing
+namespace FrameClockConstants {
+    constexpr int DEFAULT_FRAME_INTERVAL_MS = 16;  // Used if the screen reports no refresh rate
+    constexpr int DEFAULT_FRAME_BUDGET_MS = 8;     // GUI time per frame for all views together
+    constexpr int MAX_DEFERRAL_MS = 500;           // A deferred view runs after this long regardless of budget
+}
+
+// Application-wide frame clock for live views (plots, value widgets, periodic status).
+// Frames start on a fixed grid of the screen refresh interval, and only when some view
+// is due, so views that update at different rates still wake the GUI thread together.
+// In a frame, due views get a FrameClockInterface::FrameEvent in priority order (older
+// requests first within a priority) until the frame budget is spent; the rest are
+// deferred to the next frame.
+// Exposed to modules through the FrameClockInterface application property.
+class FrameClock : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FrameClock(QObject* parent = nullptr);
+    ~FrameClock() override;
+
+    // Register a view; intervalMs > 0 updates it periodically, 0 only after requestFrame
+    Q_INVOKABLE void registerView(QObject* view, int priority, int intervalMs = 0);
+    Q_INVOKABLE void unregisterView(QObject* view);
+
+    // Update the view in the next frame. Other threads call it with Qt::QueuedConnection
+    Q_INVOKABLE void requestFrame(QObject* view);
+
+    // GUI time all views may take per frame
+    void setFrameBudget(int milliseconds);
+    int frameBudget() const;
+
+    int frameInterval() const;
+
+    // Views whose update was postponed because a frame ran out of budget, since start
+    quint64 deferredCount() const;
+
+private Q_SLOTS:
+    void onFrame();
+
+private:
+    struct View
+    {
+        QPointer<QObject> object;
+        int priority = 0;
+        int intervalMs = 0;
+        bool requested = false;
+        qint64 requestedAt = 0;   // ms on the clock
+        qint64 lastUpdate = 0;    // ms on the clock
+    };
+
+    qint64 dueAt(const View& view) const;  // -1 if not due at all
+    void schedule();                       // Start the timer for the frame where the next view is due
+
+    QTimer* timer;
+    QElapsedTimer clock;
+    QList<View> views;
+    int intervalMs;
+    int budgetMs;
+    qint64 scheduledAt = -1;  // Frame the timer is set for
+    quint64 deferred = 0;
+};
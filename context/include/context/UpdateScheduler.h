@@ -5,6 +5,8 @@
 #include <QPointer>
 #include <QList>
 
+class FrameClock;
+
 // Constants for timer intervals
 namespace UpdateSchedulerConstants {
     constexpr int SCHEDULER_INTERVAL_MS = 10;      // OpenDAQ scheduler main loop interval
@@ -22,14 +24,14 @@ public:
 };
 
 // Global scheduler that manages periodic updates for multiple objects
-// Uses a single QTimer to update all registered objects
+// Updates all registered objects together as one low-priority view of the frame clock
 // Uses QPointer for safe weak references - automatically becomes null when object is deleted
 class UpdateScheduler : public QObject
 {
     Q_OBJECT
 
 public:
-    explicit UpdateScheduler(QObject* parent = nullptr);
+    explicit UpdateScheduler(FrameClock* frameClock, QObject* parent = nullptr);
     ~UpdateScheduler() override;
 
     // Register a QObject-based updatable for periodic updates
@@ -48,6 +50,9 @@ public:
     // Get number of registered objects (includes null pointers)
     int count() const;
 
+protected:
+    bool event(QEvent* event) override;
+
 private Q_SLOTS:
     void onSchedulerTimeout();
     void onUpdatablesTimeout();
@@ -55,8 +60,9 @@ private Q_SLOTS:
 
 private:
     QTimer* schedulerTimer;   // Runs every 10ms for openDAQ scheduler
-    QTimer* timer;            // Runs every second for updatables
+    FrameClock* frameClock;   // Paces updatables, every second by default
     QTimer* eventQueueTimer;  // Runs every 10ms for event queue processing
     QList<QPointer<QObject>> updatables;
+    int updatablesInterval;
 };
 
@@ -1,7 +1,10 @@
 #include "context/AppContext.h"
 #include "context/UpdateScheduler.h"
+#include "context/FrameClock.h"
 #include "context/QueuedEventHandler.h"
 #include "logger/qt_text_edit_sink.h"
+#include <frame_clock_interface/frame_clock_interface.h>
+#include <QCoreApplication>
 #include <QTableWidget>
 
 #include <opendaq/opendaq.h>
@@ -18,6 +21,7 @@ public:
     bool expandAllProperties = true;
     QSet<QString> componentTypes; // empty means show all
     daq::LoggerSinkPtr loggerSink;
+    FrameClock* frameClock = nullptr;
     UpdateScheduler* scheduler = nullptr;
     EventQueue eventQueue;
 };
@@ -26,7 +30,12 @@ AppContext::AppContext(QObject* parent)
     : QObject(parent)
     , d(std::make_unique<Private>())
 {
-    d->scheduler = new UpdateScheduler(this);
+    d->frameClock = new FrameClock(this);
+    d->scheduler = new UpdateScheduler(d->frameClock, this);
+
+    // Modules don't link the context library; they find the clock through the application
+    if (auto* app = QCoreApplication::instance())
+        app->setProperty(FrameClockInterface::ApplicationProperty, QVariant::fromValue<QObject*>(d->frameClock));
     d->loggerSink = createQTableWidgetLoggerSink();
 }
 
@@ -145,6 +154,11 @@ UpdateScheduler* AppContext::updateScheduler() const
     return d->scheduler;
 }
 
+FrameClock* AppContext::frameClock() const
+{
+    return d->frameClock;
+}
+
 EventQueue* AppContext::eventQueue() const
 {
     return &d->eventQueue;
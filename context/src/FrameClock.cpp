@@ -0,0 +1,222 @@
+#include "context/FrameClock.h"
+#include "context/AppContext.h"
+#include <frame_clock_interface/frame_clock_interface.h>
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QScreen>
+#include <opendaq/opendaq.h>
+#include <opendaq/custom_log.h>
+#include <algorithm>
+#include <cmath>
+
+FrameClock::FrameClock(QObject* parent)
+    : QObject(parent)
+    , timer(new QTimer(this))
+    , intervalMs(FrameClockConstants::DEFAULT_FRAME_INTERVAL_MS)
+    , budgetMs(FrameClockConstants::DEFAULT_FRAME_BUDGET_MS)
+{
+    // Frame grid follows the primary screen's refresh rate
+    if (auto* screen = QGuiApplication::primaryScreen())
+    {
+        const qreal refreshRate = screen->refreshRate();
+        if (refreshRate > 1.0)
+            intervalMs = std::max(1, static_cast<int>(std::lround(1000.0 / refreshRate)));
+    }
+
+    timer->setSingleShot(true);
+    timer->setTimerType(Qt::PreciseTimer);
+    connect(timer, &QTimer::timeout, this, &FrameClock::onFrame);
+    clock.start();
+}
+
+FrameClock::~FrameClock()
+{
+    timer->stop();
+}
+
+void FrameClock::registerView(QObject* view, int priority, int intervalMs)
+{
+    if (!view)
+        return;
+
+    for (auto& entry : views)
+    {
+        if (entry.object.data() == view)
+        {
+            entry.priority = priority;
+            entry.intervalMs = intervalMs;
+            schedule();
+            return;
+        }
+    }
+
+    View entry;
+    entry.object = view;
+    entry.priority = priority;
+    entry.intervalMs = intervalMs;
+    entry.lastUpdate = clock.elapsed();
+    views.append(entry);
+    schedule();
+}
+
+void FrameClock::unregisterView(QObject* view)
+{
+    views.erase(std::remove_if(views.begin(), views.end(), [view](const View& entry)
+                {
+                    return entry.object.isNull() || entry.object.data() == view;
+                }),
+                views.end());
+    schedule();
+}
+
+void FrameClock::requestFrame(QObject* view)
+{
+    for (auto& entry : views)
+    {
+        if (entry.object.data() == view && !entry.requested)
+        {
+            entry.requested = true;
+            entry.requestedAt = clock.elapsed();
+            schedule();
+            return;
+        }
+    }
+}
+
+void FrameClock::setFrameBudget(int milliseconds)
+{
+    budgetMs = std::max(1, milliseconds);
+}
+
+int FrameClock::frameBudget() const
+{
+    return budgetMs;
+}
+
+int FrameClock::frameInterval() const
+{
+    return intervalMs;
+}
+
+quint64 FrameClock::deferredCount() const
+{
+    return deferred;
+}
+
+qint64 FrameClock::dueAt(const View& view) const
+{
+    qint64 due = -1;
+    if (view.requested)
+        due = view.requestedAt;
+    if (view.intervalMs > 0)
+    {
+        const qint64 periodic = view.lastUpdate + view.intervalMs;
+        due = due < 0 ? periodic : std::min(due, periodic);
+    }
+    return due;
+}
+
+void FrameClock::schedule()
+{
+    qint64 earliest = -1;
+    for (const auto& entry : views)
+    {
+        if (entry.object.isNull())
+            continue;
+        const qint64 due = dueAt(entry);
+        if (due >= 0 && (earliest < 0 || due < earliest))
+            earliest = due;
+    }
+
+    if (earliest < 0)
+    {
+        timer->stop();
+        scheduledAt = -1;
+        return;
+    }
+
+    // First frame on the grid at or after the due time, never in the past
+    const qint64 now = clock.elapsed();
+    const qint64 target = std::max(earliest, now);
+    const qint64 frame = (target + intervalMs - 1) / intervalMs * intervalMs;
+    if (timer->isActive() && scheduledAt >= 0 && scheduledAt <= frame)
+        return;
+
+    scheduledAt = frame;
+    timer->start(static_cast<int>(frame - now));
+}
+
+void FrameClock::onFrame()
+{
+    scheduledAt = -1;
+
+    // Views deleted without unregistering
+    views.erase(std::remove_if(views.begin(), views.end(), [](const View& entry) { return entry.object.isNull(); }),
+                views.end());
+
+    const qint64 now = clock.elapsed();
+
+    // Due views by priority, the longest waiting first within a priority
+    struct Due
+    {
+        QPointer<QObject> object;
+        int priority;
+        qint64 since;
+    };
+    QList<Due> due;
+    for (const auto& entry : views)
+    {
+        const qint64 dueTime = dueAt(entry);
+        if (dueTime >= 0 && dueTime <= now)
+            due.append({entry.object, entry.priority, dueTime});
+    }
+    std::stable_sort(due.begin(), due.end(), [](const Due& a, const Due& b)
+    {
+        if (a.priority != b.priority)
+            return a.priority > b.priority;
+        return a.since < b.since;
+    });
+
+    // Views may register, unregister or delete others while updating, so entries are looked up again
+    QElapsedTimer frameTime;
+    frameTime.start();
+    int updated = 0;
+    for (const auto& next : due)
+    {
+        if (next.object.isNull())
+            continue;
+
+        // Out of budget: defer, unless the view has already waited too long
+        if (updated > 0 && frameTime.elapsed() >= budgetMs && now - next.since < FrameClockConstants::MAX_DEFERRAL_MS)
+        {
+            ++deferred;
+            continue;
+        }
+
+        auto it = std::find_if(views.begin(), views.end(), [&next](const View& entry) { return entry.object == next.object; });
+        if (it == views.end())
+            continue;
+        it->requested = false;
+        it->lastUpdate = now;
+        ++updated;
+
+        try
+        {
+            QEvent event(FrameClockInterface::FrameEvent);
+            QCoreApplication::sendEvent(next.object.data(), &event);
+        }
+        catch (const std::exception& e)
+        {
+            // One failing view must not stop the others
+            const auto loggerComponent = AppContext::LoggerComponent();
+            LOG_W("Error in frame update: {}", e.what());
+        }
+        catch (...)
+        {
+            const auto loggerComponent = AppContext::LoggerComponent();
+            LOG_W("Unknown error in frame update");
+        }
+    }
+
+    schedule();
+}
@@ -1,15 +1,18 @@
 #include "context/UpdateScheduler.h"
 #include "context/AppContext.h"
 #include "context/QueuedEventHandler.h"
+#include "context/FrameClock.h"
+#include <frame_clock_interface/frame_clock_interface.h>
 #include <opendaq/opendaq.h>
 #include <opendaq/custom_log.h>
 #include <algorithm>
 
-UpdateScheduler::UpdateScheduler(QObject* parent)
+UpdateScheduler::UpdateScheduler(FrameClock* frameClock, QObject* parent)
     : QObject(parent)
     , schedulerTimer(new QTimer(this))
-    , timer(new QTimer(this))
+    , frameClock(frameClock)
     , eventQueueTimer(new QTimer(this))
+    , updatablesInterval(UpdateSchedulerConstants::DEFAULT_UPDATABLES_INTERVAL_MS)
 {
     // Scheduler timer runs every 10ms for openDAQ main loop
     // Must run in main thread - timer is created in main thread so this is guaranteed
@@ -17,10 +20,6 @@ UpdateScheduler::UpdateScheduler(QObject* parent)
     schedulerTimer->setInterval(UpdateSchedulerConstants::SCHEDULER_INTERVAL_MS);
     schedulerTimer->start(); // Always running for openDAQ scheduler
 
-    // Updatables timer runs every second
-    connect(timer, &QTimer::timeout, this, &UpdateScheduler::onUpdatablesTimeout);
-    timer->setInterval(UpdateSchedulerConstants::DEFAULT_UPDATABLES_INTERVAL_MS);
-
     // Event queue timer runs every 10ms to dispatch queued events
     connect(eventQueueTimer, &QTimer::timeout, this, &UpdateScheduler::onEventQueueTimeout);
     eventQueueTimer->setInterval(UpdateSchedulerConstants::EVENT_QUEUE_INTERVAL_MS);
@@ -30,7 +29,6 @@ UpdateScheduler::UpdateScheduler(QObject* parent)
 UpdateScheduler::~UpdateScheduler()
 {
     schedulerTimer->stop();
-    timer->stop();
     eventQueueTimer->stop();
 }
 
@@ -48,9 +46,9 @@ void UpdateScheduler::registerUpdatable(QObject* updatable)
 
     updatables.append(QPointer<QObject>(updatable));
 
-    // Start updatables timer if this is the first registered object
-    if (updatables.size() == 1)
-        timer->start();
+    // Join the frame clock with the first registered object
+    if (updatables.size() == 1 && frameClock)
+        frameClock->registerView(this, FrameClockInterface::Low, updatablesInterval);
 }
 
 void UpdateScheduler::unregisterUpdatable(QObject* updatable)
@@ -64,19 +62,21 @@ void UpdateScheduler::unregisterUpdatable(QObject* updatable)
     // Clean up null pointers while we're at it
     updatables.removeAll(QPointer<QObject>());
 
-    // Stop updatables timer if no more objects to update
-    if (updatables.isEmpty())
-        timer->stop();
+    // Leave the frame clock if no more objects to update
+    if (updatables.isEmpty() && frameClock)
+        frameClock->unregisterView(this);
 }
 
 void UpdateScheduler::setInterval(int milliseconds)
 {
-    timer->setInterval(milliseconds);
+    updatablesInterval = milliseconds;
+    if (!updatables.isEmpty() && frameClock)
+        frameClock->registerView(this, FrameClockInterface::Low, updatablesInterval);
 }
 
 int UpdateScheduler::interval() const
 {
-    return timer->interval();
+    return updatablesInterval;
 }
 
 int UpdateScheduler::count() const
@@ -84,6 +84,16 @@ int UpdateScheduler::count() const
     return updatables.size();
 }
 
+bool UpdateScheduler::event(QEvent* event)
+{
+    if (event->type() == FrameClockInterface::FrameEvent)
+    {
+        onUpdatablesTimeout();
+        return true;
+    }
+    return QObject::event(event);
+}
+
 void UpdateScheduler::onSchedulerTimeout()
 {
     // Run openDAQ scheduler main loop iteration to process events
@@ -111,7 +121,7 @@ void UpdateScheduler::onUpdatablesTimeout()
 {
     // Use erase-remove idiom for efficient removal of null pointers
     // QPointer automatically becomes null if the object was deleted
-    // Called every second
+    // Called in a frame of the frame clock, every second by default
     updatables.erase(
         std::remove_if(updatables.begin(), updatables.end(), [](QPointer<QObject>& ptr)
         {
@@ -145,9 +155,9 @@ void UpdateScheduler::onUpdatablesTimeout()
         updatables.end()
     );
 
-    // Stop timer if all objects were deleted
-    if (updatables.isEmpty())
-        timer->stop();
+    // Leave the frame clock if all objects were deleted
+    if (updatables.isEmpty() && frameClock)
+        frameClock->unregisterView(this);
 }
 
 void UpdateScheduler::onEventQueueTimeout()
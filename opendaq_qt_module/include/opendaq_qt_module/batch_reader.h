@@ -0,0 +1,63 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/input_port_ptr.h>
+#include <opendaq/multi_reader_ptr.h>
+#include <opendaq/multi_reader_status_ptr.h>
+#include <opendaq/sample_type.h>
+#include <functional>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// One aligned reader for the signals of a plotter that share a domain, like the
+// channels of one DAQ card. A MultiReader reads the values of every port per call,
+// all in one sample type. The ports are aligned, so their ticks are the same: they
+// are read into a single buffer once and every signal's history stores them from there.
+class BatchReader
+{
+public:
+    // Takes over the ports, which must not have readers of their own; throws if they cannot be read together
+    BatchReader(const std::vector<daq::InputPortPtr>& ports,
+                daq::SampleType valueType,
+                daq::SampleType domainType,
+                std::function<void()> onDataAvailable);
+    ~BatchReader();
+
+    BatchReader(const BatchReader&) = delete;
+    BatchReader& operator=(const BatchReader&) = delete;
+
+    daq::SampleType valueType() const { return valueSampleType; }
+    daq::SampleType domainType() const { return domainSampleType; }
+
+    // Read everything available; returns the number of samples read per port. Stops at
+    // an event, after which the descriptors may no longer match and the batch has to go.
+    size_t read();
+    bool hasEvent() const;
+    bool isValid() const;  // False once the reader cannot continue after an event
+    daq::EventPacketPtr eventFor(const daq::InputPortPtr& port) const;  // Of the last read, nullptr if none
+
+    // Samples of the last read: values of the port at `index` (in constructor order) and the common ticks
+    const void* values(size_t index) const { return valuePointers[index]; }
+    const void* ticks() const { return tickBuffer.data(); }
+
+private:
+    daq::MultiReaderPtr reader;
+    daq::MultiReaderStatusPtr status;
+    daq::SampleType valueSampleType;
+    daq::SampleType domainSampleType;
+
+    // Reusable read buffers; native read types are at most 8 bytes, so a double per sample fits and aligns any of them
+    std::vector<std::vector<double>> valueBuffers;
+    std::vector<void*> valuePointers;
+    std::vector<double> tickBuffer;
+    std::vector<void*> tickPointers;  // Every port writes its (identical) ticks to tickBuffer
+    size_t bufferSamples = 0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,64 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/waterfall_image.h>
+#include <QRgb>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Persistence display of (x, y) pairs: every pair adds a hit to the cell it falls into.
+// Memory and drawing cost depend on the raster size only, not on the number of points.
+// Decay is O(1): instead of scaling every cell down, new hits are weighted up, and the
+// cells are renormalized once the weight gets large.
+class DensityRaster
+{
+public:
+    void resize(int width, int height);  // Clears
+    void clear();
+
+    int width() const { return rasterWidth; }
+    int height() const { return rasterHeight; }
+
+    // Value range mapped onto the raster; a changed range clears it
+    void setRange(double xMin, double xMax, double yMin, double yMax);
+    bool hasRange() const { return xMax > xMin && yMax > yMin; }
+    double minX() const { return xMin; }
+    double maxX() const { return xMax; }
+    double minY() const { return yMin; }
+    double maxY() const { return yMax; }
+
+    // Returns the number of pairs inside the range; NaN and pairs outside are skipped
+    size_t accumulate(const double* x, const double* y, size_t count);
+
+    void decay(double factor);  // Scale all hits by factor in (0, 1]
+    bool empty() const { return peak <= 0.0; }
+
+    // width() * height() pixels, top row first with y growing upwards. Intensity is
+    // logarithmic in the hits of a cell relative to the fullest one; cells that decayed
+    // below a tenth of a hit are drawn as empty.
+    void render(const ColorTable& colors, QRgb* pixels);
+
+private:
+    void renormalize();
+
+    int rasterWidth = 0;
+    int rasterHeight = 0;
+    std::vector<float> cells;  // Row 0 holds the lowest y
+    double xMin = 0.0;
+    double xMax = 0.0;
+    double yMin = 0.0;
+    double yMax = 0.0;
+    double weight = 1.0;  // Value of a hit added now
+    double peak = 0.0;    // Largest cell value
+
+    std::array<QRgb, 4096> levelColors{};  // Render: colour per cell / peak step
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,492 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/signal_history.h>
+#include <opendaq_qt_module/simd_kernels.h>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Downsampling methods for high-frequency signals
+enum class DownsampleMethod
+{
+    None = 0,    // No downsampling - show all points (may be slow)
+    Simple = 1,  // Take every Nth point
+    MinMax = 2,  // Keep min and max in each bucket (preserves peaks)
+    LTTB = 3     // Largest Triangle Three Buckets (best visual quality)
+};
+
+// Adapts a point list (e.g. a pyramid envelope) to the accessors the downsamplers use on SignalHistory
+struct PointsView
+{
+    using ValueType = double;
+
+    const QVector<QPointF>& points;
+
+    double timeAt(int i) const { return points[i].x(); }
+    double valueAt(int i) const { return points[i].y(); }
+    const QPointF& pointAt(int i) const { return points[i]; }
+
+    // Interleaved, so the kernels get copies
+    static constexpr bool HasValueRuns = false;
+
+    void valuesInto(int first, int last, double* out) const
+    {
+        for (int i = first; i <= last; ++i)
+            *out++ = points[i].y();
+    }
+
+    void timesInto(int first, int last, double* out) const
+    {
+        for (int i = first; i <= last; ++i)
+            *out++ = points[i].x();
+    }
+};
+
+// Values the vectorised kernels can compare as double without changing the result
+template <typename T>
+constexpr bool isExactInDouble = std::is_floating_point_v<T> ? sizeof(T) <= sizeof(double)
+                                                             : std::is_integral_v<T> && sizeof(T) <= 4;
+
+// Structure-of-arrays copy of one bucket for the kernels, and the envelope that gets
+// downsampled further; reused per thread, so they only grow while frames get bigger
+struct KernelScratch
+{
+    std::vector<double> times;
+    std::vector<double> values;
+    QVector<QPointF> envelope;
+
+    static KernelScratch& local()
+    {
+        thread_local KernelScratch scratch;
+        return scratch;
+    }
+};
+
+// Sources whose double values the kernels can read in place
+template <typename Source>
+constexpr bool hasDoubleRuns = Source::HasValueRuns && std::is_same_v<typename Source::ValueType, double>;
+
+// Kernels::minMaxIndex over the source's values in [first, last]. Double values are read in
+// place, run by run: a later run only wins with a strictly lower or higher value, as later
+// samples do in the scalar loop. Anything else is widened into the scratch first.
+template <typename Source>
+void bucketMinMaxIndex(const Source& source, int first, int last, int& minIdx, int& maxIdx)
+{
+    if constexpr (hasDoubleRuns<Source>)
+    {
+        const double* run = nullptr;
+        int runCount = source.valueRun(first, last, run);
+        Kernels::minMaxIndex(run, runCount, minIdx, maxIdx);
+        double minVal = run[minIdx];
+        double maxVal = run[maxIdx];
+        minIdx += first;
+        maxIdx += first;
+
+        for (int pos = first + runCount; pos <= last; pos += runCount)
+        {
+            runCount = source.valueRun(pos, last, run);
+
+            // Leading NaNs would be the run's own extremes; the scalar loop passes over them
+            int skip = 0;
+            while (skip < runCount && std::isnan(run[skip]))
+                ++skip;
+            if (skip == runCount)
+                continue;
+
+            int runMin = 0;
+            int runMax = 0;
+            Kernels::minMaxIndex(run + skip, runCount - skip, runMin, runMax);
+            if (run[skip + runMin] < minVal)
+            {
+                minVal = run[skip + runMin];
+                minIdx = pos + skip + runMin;
+            }
+            if (run[skip + runMax] > maxVal)
+            {
+                maxVal = run[skip + runMax];
+                maxIdx = pos + skip + runMax;
+            }
+        }
+    }
+    else
+    {
+        auto& values = KernelScratch::local().values;
+        values.resize(static_cast<size_t>(last - first + 1));
+        source.valuesInto(first, last, values.data());
+        Kernels::minMaxIndex(values.data(), static_cast<int>(values.size()), minIdx, maxIdx);
+        minIdx += first;
+        maxIdx += first;
+    }
+}
+
+// Kernels::largestTriangleIndex over [first, last]. Times are widened run by run; double
+// values are read in place unless the bucket wraps around the end of the ring.
+template <typename Source>
+int bucketLargestTriangleIndex(const Source& source, int first, int last,
+                               double timeA, double valA, double avgX, double avgY)
+{
+    auto& scratch = KernelScratch::local();
+    const int count = last - first + 1;
+    scratch.times.resize(static_cast<size_t>(count));
+    source.timesInto(first, last, scratch.times.data());
+
+    const double* values = nullptr;
+    if constexpr (hasDoubleRuns<Source>)
+    {
+        if (source.valueRun(first, last, values) < count)
+            values = nullptr;
+    }
+    if (!values)
+    {
+        scratch.values.resize(static_cast<size_t>(count));
+        source.valuesInto(first, last, scratch.values.data());
+        values = scratch.values.data();
+    }
+
+    return first + Kernels::largestTriangleIndex(scratch.times.data(), values, count, timeA, valA, avgX, avgY);
+}
+
+// Downsampling methods for visible points. A Source provides timeAt(i) (ms), valueAt(i)
+// (native value type) and pointAt(i) (widened QPointF) for indices in [beginIdx, endIdx];
+// only the points that end up in the result are widened.
+// Results are appended to `result`, whose capacity the caller keeps between frames.
+
+template <typename Source>
+void downsampleVisibleNone(const Source& source, int beginIdx, int endIdx, QVector<QPointF>& result)
+{
+    // No downsampling - append all points in range
+    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx)
+        return;
+    result.reserve(result.size() + endIdx - beginIdx + 1);
+    for (int i = beginIdx; i <= endIdx; ++i)
+        result.append(source.pointAt(i));
+}
+
+template <typename Source>
+void downsampleVisibleSimple(const Source& source, int beginIdx, int endIdx, size_t targetPoints, QVector<QPointF>& result)
+{
+    // Simple downsampling - take every Nth point
+    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx || targetPoints == 0)
+        return;
+    
+    size_t visibleCount = endIdx - beginIdx + 1;
+    if (visibleCount <= targetPoints)
+    {
+        // Return all points
+        downsampleVisibleNone(source, beginIdx, endIdx, result);
+        return;
+    }
+    
+    size_t step = visibleCount / targetPoints;
+    if (step < 1) step = 1;
+    
+    const size_t resultEnd = static_cast<size_t>(result.size()) + targetPoints;
+    result.reserve(static_cast<int>(resultEnd));
+    for (int i = beginIdx; i <= endIdx && static_cast<size_t>(result.size()) < resultEnd; i += static_cast<int>(step))
+    {
+        result.append(source.pointAt(i));
+    }
+}
+
+template <typename Source>
+void downsampleVisibleMinMax(const Source& source, int beginIdx, int endIdx, size_t targetPoints, QVector<QPointF>& result)
+{
+    // Min-Max downsampling - preserves signal peaks and valleys
+    // Each bucket produces 2 points (min and max)
+    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx || targetPoints == 0)
+        return;
+    
+    size_t visibleCount = endIdx - beginIdx + 1;
+    if (visibleCount <= targetPoints)
+    {
+        // Return all points
+        downsampleVisibleNone(source, beginIdx, endIdx, result);
+        return;
+    }
+    
+    size_t bucketSize = visibleCount / (targetPoints / 2);  // /2 because each bucket adds 2 points
+    if (bucketSize < 2) bucketSize = 2;
+    
+    // Reserve estimated space (each bucket adds up to 2 points)
+    const size_t resultStart = static_cast<size_t>(result.size());
+    const size_t resultEnd = resultStart + targetPoints;
+    size_t estimatedPoints = (visibleCount / bucketSize) * 2 + 2;
+    result.reserve(static_cast<int>(resultStart + std::min(estimatedPoints, targetPoints)));
+    
+    for (int bucketStart = beginIdx; bucketStart <= endIdx && static_cast<size_t>(result.size()) < resultEnd - 1; bucketStart += static_cast<int>(bucketSize))
+    {
+        int bucketEnd = std::min(bucketStart + static_cast<int>(bucketSize) - 1, endIdx);
+        
+        // Find min and max in bucket
+        int minIdx = bucketStart, maxIdx = bucketStart;
+        if constexpr (isExactInDouble<typename Source::ValueType>)
+        {
+            bucketMinMaxIndex(source, bucketStart, bucketEnd, minIdx, maxIdx);
+        }
+        else
+        {
+            // 64-bit integers don't fit a double; compared in the source's native value type
+            auto minVal = source.valueAt(bucketStart);
+            auto maxVal = minVal;
+            for (int i = bucketStart + 1; i <= bucketEnd; ++i)
+            {
+                const auto value = source.valueAt(i);
+                if (value < minVal) { minVal = value; minIdx = i; }
+                if (value > maxVal) { maxVal = value; maxIdx = i; }
+            }
+        }
+        
+        // Add points in time order (important for correct line rendering)
+        if (minIdx < maxIdx)
+        {
+            result.append(source.pointAt(minIdx));
+            if (minIdx != maxIdx && static_cast<size_t>(result.size()) < resultEnd)
+                result.append(source.pointAt(maxIdx));
+        }
+        else
+        {
+            result.append(source.pointAt(maxIdx));
+            if (static_cast<size_t>(result.size()) < resultEnd)
+                result.append(source.pointAt(minIdx));
+        }
+    }
+}
+
+template <typename Source>
+void downsampleVisibleLTTB(const Source& source, int beginIdx, int endIdx, size_t targetPoints, QVector<QPointF>& result)
+{
+    // Largest Triangle Three Buckets (LTTB) - best visual quality downsampling
+    // Algorithm: https://github.com/sveinn-steinarsson/flot-downsample
+    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx || targetPoints == 0)
+        return;
+    
+    size_t count = endIdx - beginIdx + 1;
+    if (count <= targetPoints)
+    {
+        // Return all points
+        downsampleVisibleNone(source, beginIdx, endIdx, result);
+        return;
+    }
+    
+    if (targetPoints < 3)
+    {
+        // Need at least 3 points for LTTB, fall back to simple
+        downsampleVisibleSimple(source, beginIdx, endIdx, targetPoints, result);
+        return;
+    }
+    
+    result.reserve(result.size() + static_cast<int>(targetPoints));
+    
+    // Always include first point
+    result.append(source.pointAt(beginIdx));
+    
+    // Calculate bucket size
+    size_t bucketSize = (count - 2) / (targetPoints - 2);  // -2 for first and last points
+    if (bucketSize < 1) bucketSize = 1;
+    
+    int a = beginIdx;  // Index of first point in current bucket (absolute index in source)
+    
+    for (size_t i = 0; i < targetPoints - 2; ++i)
+    {
+        // Calculate range for next bucket (relative to beginIdx)
+        size_t rangeStartRel = (i + 1) * bucketSize;
+        size_t rangeEndRel = std::min((i + 2) * bucketSize, count - 1);
+        int rangeStart = beginIdx + static_cast<int>(rangeStartRel);
+        int rangeEnd = beginIdx + static_cast<int>(rangeEndRel);
+        
+        // Calculate average point of next bucket for triangle comparison
+        double avgX = 0.0, avgY = 0.0;
+        size_t avgCount = 0;
+        for (int j = rangeStart; j <= rangeEnd; ++j)
+        {
+            avgX += source.timeAt(j);
+            avgY += source.valueAt(j);
+            avgCount++;
+        }
+        if (avgCount > 0)
+        {
+            avgX /= avgCount;
+            avgY /= avgCount;
+        }
+        
+        // Calculate range for current bucket (from a+1 to rangeStart)
+        int rangeStartCurr = a + 1;
+        int rangeEndCurr = std::min(rangeStart - 1, endIdx);
+        
+        // Find point in current bucket that forms largest triangle with avg point
+        int maxAreaIdx = rangeStartCurr;
+        
+        if (rangeStartCurr <= rangeEndCurr)
+        {
+            double timeA = source.timeAt(a);
+            double valA = source.valueAt(a);
+            
+            // Triangle area using cross product:
+            // Area = |(avgX - timeA) * (valJ - valA) - (timeJ - timeA) * (avgY - valA)| / 2
+            maxAreaIdx = bucketLargestTriangleIndex(source, rangeStartCurr, rangeEndCurr, timeA, valA, avgX, avgY);
+        }
+        
+        // Add the point with largest triangle area
+        if (maxAreaIdx < beginIdx || maxAreaIdx > endIdx)
+            maxAreaIdx = rangeStart - 1;
+        
+        if (maxAreaIdx >= beginIdx && maxAreaIdx <= endIdx)
+        {
+            result.append(source.pointAt(maxAreaIdx));
+            a = maxAreaIdx;
+        }
+        else
+        {
+            a = rangeStart;
+        }
+    }
+    
+    // Always include last point
+    result.append(source.pointAt(endIdx));
+}
+
+// Time-ordered min/max envelope of [beginIdx, endIdx] built from the given pyramid level,
+// refined to raw samples at the edges where no complete bucket exists; appended to `envelope`
+template <typename History>
+void buildEnvelope(const History& history, int level, int beginIdx, int endIdx, QVector<QPointF>& envelope)
+{
+    const auto& pyramid = history.minMaxPyramid();
+    const qint64 visibleCount = static_cast<qint64>(endIdx - beginIdx + 1);
+
+    envelope.reserve(envelope.size() +
+                     static_cast<int>((visibleCount >> level) * 2 + 4 * (qint64(1) << MinMaxPyramid<typename History::ValueType>::MinLevel)));
+
+    pyramid.visit(level,
+                  history.absoluteIndex(beginIdx),
+                  history.absoluteIndex(endIdx),
+                  [&](qint64 first, qint64 last)
+                  {
+                      const int lastIdx = history.logicalIndex(last);
+                      for (int i = history.logicalIndex(first); i <= lastIdx; ++i)
+                          envelope.append(history.pointAt(i));
+                  },
+                  [&](const auto& bucket)
+                  {
+                      // Min and max in time order (important for correct line rendering)
+                      const int minIdx = history.logicalIndex(bucket.minIndex);
+                      const int maxIdx = history.logicalIndex(bucket.maxIndex);
+                      if (minIdx < maxIdx)
+                      {
+                          envelope.append(history.pointAt(minIdx));
+                          envelope.append(history.pointAt(maxIdx));
+                      }
+                      else if (maxIdx < minIdx)
+                      {
+                          envelope.append(history.pointAt(maxIdx));
+                          envelope.append(history.pointAt(minIdx));
+                      }
+                      else
+                      {
+                          envelope.append(history.pointAt(minIdx));
+                      }
+                  });
+}
+
+// Envelope points downsampled further to at most maxSamples, appended to `result`
+inline void downsampleEnvelope(const QVector<QPointF>& envelope, DownsampleMethod method, size_t maxSamples, QVector<QPointF>& result)
+{
+    if (static_cast<size_t>(envelope.size()) <= maxSamples)
+    {
+        result.append(envelope);
+        return;
+    }
+
+    const PointsView view{envelope};
+    const int lastIdx = envelope.size() - 1;
+    switch (method)
+    {
+        case DownsampleMethod::Simple:
+            downsampleVisibleSimple(view, 0, lastIdx, maxSamples, result);
+            break;
+        case DownsampleMethod::LTTB:
+            downsampleVisibleLTTB(view, 0, lastIdx, maxSamples, result);
+            break;
+        default:
+            // An envelope can be far larger than None could draw
+            downsampleVisibleMinMax(view, 0, lastIdx, maxSamples, result);
+            break;
+    }
+}
+
+// Parameters of one visible-series update
+struct VisibleRequest
+{
+    double visibleMin = 0.0;
+    double visibleMax = 0.0;
+    DownsampleMethod method = DownsampleMethod::LTTB;
+    size_t maxSamples = 0;
+    qreal pixelWidth = 0.0;
+    bool followLatest = false;  // Auto-follow: the range only moves forward with new data
+    quint64 viewKey = 0;        // Views of one history with different keys keep separate incremental state
+};
+
+// Points of `history` to show for the visible range, downsampled per `request`; appended to `pointsToShow`
+template <typename History>
+void buildVisiblePoints(const History& history, const VisibleRequest& request, QVector<QPointF>& pointsToShow)
+{
+    // Get visible range indices from history buffer
+    auto [beginIdx, endIdx] = history.visibleRange(request.visibleMin, request.visibleMax);
+    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx)
+        return;
+
+    size_t visibleCount = endIdx - beginIdx + 1;
+    const size_t maxSamples = request.maxSamples;
+
+    // Zoomed out: summarise from the coarsest pyramid level that still gives ~2 buckets per pixel,
+    // so the cost follows the plot width instead of the number of samples in view
+    if (visibleCount > maxSamples &&
+        (request.method == DownsampleMethod::MinMax || request.method == DownsampleMethod::LTTB))
+    {
+        const qint64 targetBuckets = static_cast<qint64>(request.pixelWidth) * 2;
+        const int level = history.minMaxPyramid().chooseLevel(static_cast<qint64>(visibleCount), targetBuckets);
+        if (level >= 0)
+        {
+            auto& envelope = KernelScratch::local().envelope;
+            envelope.resize(0);
+            buildEnvelope(history, level, beginIdx, endIdx, envelope);
+            downsampleEnvelope(envelope, request.method, maxSamples, pointsToShow);
+            return;
+        }
+    }
+
+    if (visibleCount > maxSamples && request.method != DownsampleMethod::None)
+    {
+        switch (request.method)
+        {
+            case DownsampleMethod::Simple:
+                downsampleVisibleSimple(history, beginIdx, endIdx, maxSamples, pointsToShow);
+                return;
+            case DownsampleMethod::MinMax:
+                downsampleVisibleMinMax(history, beginIdx, endIdx, maxSamples, pointsToShow);
+                return;
+            case DownsampleMethod::LTTB:
+                downsampleVisibleLTTB(history, beginIdx, endIdx, maxSamples, pointsToShow);
+                return;
+            default:
+                break;
+        }
+    }
+
+    // No downsampling needed or method is None - copy all visible points
+    downsampleVisibleNone(history, beginIdx, endIdx, pointsToShow);
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
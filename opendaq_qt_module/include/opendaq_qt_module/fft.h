@@ -0,0 +1,56 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Forward FFT of real input. The size must be even with no prime factors other than
+// 2, 3 and 5 (see supportedSize). The input is transformed as a complex sequence of
+// half the size, followed by a split step that separates the spectra of the even
+// and odd samples. The complex transform is a mixed-radix Stockham FFT: radix-4
+// stages, then at most one radix-2 stage, then radix-3 and radix-5 stages. All
+// twiddles are computed when the plan is made.
+// Plans are immutable and shared, so one plan can be used by several threads at once.
+class RealFft
+{
+public:
+    // Shared plan for `size`, created on first use; size must be supported
+    static std::shared_ptr<const RealFft> plan(size_t size);
+
+    // Smallest supported size >= size (at least 2)
+    static size_t supportedSize(size_t size);
+    static bool isSupported(size_t size);
+
+    explicit RealFft(size_t size);
+
+    size_t size() const { return fftSize; }
+    size_t bins() const { return fftSize / 2 + 1; }  // DC to Nyquist
+
+    // Spectrum bins [0, bins()) of input[0, size()), unnormalised
+    void transform(const double* input, std::complex<double>* output) const;
+
+private:
+    struct Stage
+    {
+        int radix;
+        size_t length;         // Length of the sub-transforms this stage splits
+        size_t stride;         // Number of interleaved sub-transforms
+        size_t twiddleOffset;  // (radix - 1) twiddles per butterfly in `twiddles`
+    };
+
+    size_t fftSize;
+    size_t halfSize;
+    std::vector<Stage> stages;
+    std::vector<std::complex<double>> twiddles;
+    std::vector<std::complex<double>> splitTwiddles;  // exp(-2 pi i k / size), k in [0, size / 4]
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,141 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/downsampling.h>
+#include <opendaq_qt_module/ring_buffer.h>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Incremental min/max envelope for auto-follow frames.
+// While following, the visible range moves forward by a few milliseconds per
+// frame. Buckets are aligned to an absolute time grid (bucket k covers
+// [k * bucketMs, (k + 1) * bucketMs)), so a completed bucket stays the same on
+// every following frame. Each update drops buckets that scrolled out on the
+// left, rescans the last (still open) bucket and appends buckets only for
+// samples that arrived since. The cost of a frame follows the amount of new
+// data, not the length of the window.
+template <typename History>
+class FollowEnvelope
+{
+public:
+    // True if `request` is an auto-follow frame that needs summarising
+    bool accepts(const History& history, const VisibleRequest& request) const
+    {
+        if (!request.followLatest || request.pixelWidth <= 0.0 || request.visibleMax <= request.visibleMin)
+            return false;
+        // Only MinMax frames are summarised incrementally; LTTB picks its points across
+        // neighbouring buckets and keeps its own full pass
+        if (request.method != DownsampleMethod::MinMax)
+            return false;
+
+        const auto [beginIdx, endIdx] = history.visibleRange(request.visibleMin, request.visibleMax);
+        if (beginIdx < 0 || endIdx < beginIdx)
+            return false;
+        return static_cast<size_t>(endIdx - beginIdx + 1) > request.maxSamples;
+    }
+
+    // Time-ordered min/max envelope of the visible range, about two buckets per pixel; appended to `envelope`
+    void update(const History& history, const VisibleRequest& request, QVector<QPointF>& envelope)
+    {
+        // Grid width follows window length and plot width, both fixed while following;
+        // the window length is recomputed from the latest time, so allow for rounding
+        const qint64 targetBuckets =
+            std::max<qint64>(std::min<qint64>(static_cast<qint64>(request.pixelWidth) * 2,
+                                              static_cast<qint64>(request.maxSamples / 2)),
+                             1);
+        const double width = (request.visibleMax - request.visibleMin) / static_cast<double>(targetBuckets);
+        if (std::abs(width - bucketMs) > bucketMs * 1e-6)
+        {
+            buckets.clear();
+            bucketMs = width;
+        }
+
+        // Buckets that scrolled out, or whose samples the history no longer has
+        const qint64 firstVisible = gridIndex(request.visibleMin);
+        const qint64 firstSample = history.absoluteIndex(0);
+        size_t expired = 0;
+        while (expired < buckets.size() &&
+               (buckets[expired].index < firstVisible || buckets[expired].firstSample < firstSample))
+            ++expired;
+        buckets.pop_front(expired);
+
+        // The open bucket may have grown since the last frame; rebuild it with the new samples
+        int scanFrom;
+        if (!buckets.empty())
+        {
+            scanFrom = history.logicalIndex(buckets.back().firstSample);
+            buckets.pop_back();
+        }
+        else
+        {
+            scanFrom = history.binarySearchFirstGE(static_cast<double>(firstVisible) * bucketMs);
+        }
+        scan(history, scanFrom);
+
+        envelope.reserve(envelope.size() + static_cast<int>(buckets.size()) * 2);
+        for (size_t i = 0; i < buckets.size(); ++i)
+        {
+            const Bucket& bucket = buckets[i];
+            envelope.append(bucket.first);
+            if (bucket.pointCount > 1)
+                envelope.append(bucket.second);
+        }
+    }
+
+private:
+    struct Bucket
+    {
+        qint64 index = 0;        // Grid cell
+        qint64 firstSample = 0;  // Absolute index of the bucket's first sample
+        QPointF first;           // Min and max in time order
+        QPointF second;
+        int pointCount = 0;
+    };
+
+    qint64 gridIndex(double timeMsec) const { return static_cast<qint64>(std::floor(timeMsec / bucketMs)); }
+
+    void scan(const History& history, int fromIdx)
+    {
+        const int n = history.size();
+        int i = fromIdx;
+        while (i < n)
+        {
+            // Samples of one grid cell; compared in the native value type like downsampleVisibleMinMax
+            const qint64 index = gridIndex(history.timeAt(i));
+            const int bucketStart = i;
+            auto minVal = history.valueAt(i);
+            auto maxVal = minVal;
+            int minIdx = i;
+            int maxIdx = i;
+            for (++i; i < n && gridIndex(history.timeAt(i)) == index; ++i)
+            {
+                const auto value = history.valueAt(i);
+                if (value < minVal) { minVal = value; minIdx = i; }
+                if (value > maxVal) { maxVal = value; maxIdx = i; }
+            }
+
+            Bucket bucket;
+            bucket.index = index;
+            bucket.firstSample = history.absoluteIndex(bucketStart);
+            bucket.first = history.pointAt(std::min(minIdx, maxIdx));
+            bucket.second = history.pointAt(std::max(minIdx, maxIdx));
+            bucket.pointCount = minIdx == maxIdx ? 1 : 2;
+            buckets.push_back(bucket);
+        }
+    }
+
+    RingBuffer<Bucket> buckets;
+    double bucketMs = 0.0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,72 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QtGlobal>
+#include <atomic>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Debug builds count reallocations of the buffers plot frames are built in.
+// The buffers keep their capacity from frame to frame, so once they have grown to
+// the size of the view a frame must not add to the count. Release builds compile
+// the counting away.
+class FrameAllocations
+{
+public:
+    // Reallocations since start, from all threads; always 0 in release builds
+    static quint64 count()
+    {
+#ifndef NDEBUG
+        return counter().load(std::memory_order_relaxed);
+#else
+        return 0;
+#endif
+    }
+
+    // Counts one reallocation if the storage of `buffer` moved or grew while the watch was alive
+    template <typename Buffer>
+    class Watch
+    {
+    public:
+#ifndef NDEBUG
+        explicit Watch(const Buffer& buffer)
+            : buffer(buffer)
+            , data(buffer.data())
+            , capacity(static_cast<qint64>(buffer.capacity()))
+        {
+        }
+
+        ~Watch()
+        {
+            if (buffer.data() != data || static_cast<qint64>(buffer.capacity()) != capacity)
+                counter().fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        const Buffer& buffer;
+        const void* data;
+        qint64 capacity;
+#else
+        explicit Watch(const Buffer&) {}
+#endif
+
+    public:
+        Watch(const Watch&) = delete;
+        Watch& operator=(const Watch&) = delete;
+    };
+
+private:
+#ifndef NDEBUG
+    static std::atomic<quint64>& counter()
+    {
+        static std::atomic<quint64> allocations{0};
+        return allocations;
+    }
+#endif
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
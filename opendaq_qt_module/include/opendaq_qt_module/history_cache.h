@@ -0,0 +1,136 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/signal_path.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/input_port_config_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/sample_type.h>
+#include <opendaq/signal_ptr.h>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// History of one signal shared by every plotter that shows it.
+// The history reads the signal itself, through an input port and reader of its
+// own, so a signal is read and stored once however many plotters show it; their
+// own ports are only drained for the descriptor events they carry. Any subscriber
+// may call read(): one reads at a time, and the lock is held only to store what
+// was read, so queries of the other plotters and the GUI do not wait for the
+// reader. The other subscribers are notified of the samples stored.
+// Settings that differ between subscribers are combined: the longest
+// DurationHistory, the finest storage bins and the largest disk tier apply.
+// Clearing hides the samples stored so far from that subscriber only; they are
+// dropped once every subscriber has cleared them.
+// All members lock, so subscribers may use it from their own threads.
+class SharedHistory
+{
+public:
+    struct MemoryShare
+    {
+        size_t bytes = 0;           // Held now
+        size_t committedBytes = 0;  // Once pending shrinks are applied
+    };
+
+    explicit SharedHistory(const daq::SignalPtr& signal = nullptr);  // Stays empty without a signal
+    ~SharedHistory();
+
+    SharedHistory(const SharedHistory&) = delete;
+    SharedHistory& operator=(const SharedHistory&) = delete;
+
+    // `onStored` is called, with the history locked, when another subscriber stored samples
+    void subscribe(quint64 subscriber, std::function<void()> onStored = {});
+    void unsubscribe(quint64 subscriber);
+
+    // Read and store what the signal has queued, returns the number of samples stored;
+    // 0 at once while another subscriber reads
+    size_t read(quint64 subscriber);
+    quint64 version() const;  // Changes with every store and clear
+
+    // Wishes of one subscriber, combined over all of them
+    void setHistory(quint64 subscriber, double durationSec, double sampleRate);
+    void setStorageDecimation(quint64 subscriber, size_t binSize);
+    void setSpill(quint64 subscriber, const SpillConfig& config);
+    std::string takeSpillError(quint64 subscriber);  // Owner of the disk tier only
+
+    void clear(quint64 subscriber);
+
+    // As seen by `subscriber`, without the samples it cleared
+    bool isEmpty(quint64 subscriber) const;
+    double firstTime(quint64 subscriber) const;  // Of the samples, or just after the last one cleared
+    double lastTime() const;
+    double valueAtTime(quint64 subscriber, double timeMsec) const;
+    RangeStatistics statistics(quint64 subscriber, double fromMsec, double toMsec) const;
+    double findTrigger(quint64 subscriber, double afterMsec, double level, TriggerEdge edge) const;
+    void visiblePoints(quint64 subscriber, VisibleRequest request, QVector<QPointF>& points) const;  // Appends to `points`
+
+    MemoryShare memoryShare() const;  // Memory tier split evenly over the subscribers
+
+private:
+    struct Subscriber
+    {
+        double durationSec = 0.0;
+        double sampleRate = 0.0;
+        size_t binSize = 0;
+        SpillConfig spill;
+        double clearedUpTo = -std::numeric_limits<double>::infinity();  // Samples up to this time are hidden
+        std::function<void()> onStored;
+    };
+
+    // Read mutex held
+    void applyEvent(const daq::EventPacketPtr& eventPacket);  // Descriptor changes switch the reader and path
+
+    // Mutex held
+    void trim();  // Evict beyond the longest DurationHistory
+    quint64 spillOwner() const;  // Subscriber with the largest disk tier, 0 if none
+    void applySettings();  // Combined settings to path
+    double visibleAfter(quint64 subscriber) const;  // Time the subscriber's samples start after
+
+    // Reading: only whoever holds readMutex reads, or replaces `path` (with `mutex` as well)
+    std::mutex readMutex;
+    daq::InputPortConfigPtr port;  // Connected to the signal for as long as the history lives
+    daq::StreamReaderPtr reader;
+
+    mutable std::mutex mutex;
+    std::unique_ptr<ISignalPath> path;
+    std::map<quint64, Subscriber> subscribers;
+    quint64 storeVersion = 0;
+
+    DomainMapping domainMapping;
+    qint64 linearDelta = 0;
+    double historySec = 0.0;  // Longest DurationHistory of the subscribers
+    double historyRate = 0.0;
+};
+
+// Process-wide registry of shared histories by signal global ID
+class HistoryCache
+{
+public:
+    static HistoryCache& instance();
+
+    // Unique key of a history consumer
+    static quint64 newSubscriber();
+
+    // History of the signal, created for the first subscriber; released with the last pointer
+    std::shared_ptr<SharedHistory> subscribe(const daq::SignalPtr& signal, quint64 subscriber, std::function<void()> onStored);
+
+private:
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<SharedHistory>> histories;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,69 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QtGlobal>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Process-wide budget for the in-memory history of all plotters.
+// Plotters report the history bytes they are responsible for about once a second
+// and apply the degradation level they get back:
+//   0  full history as configured
+//   1  history stored as decimated bins
+//   2+ additionally the history is halved per level, never below the visible window
+// Over budget, the least recently viewed plotter that can still degrade goes one
+// level down; well under budget, the most recently viewed degraded plotter goes
+// one level up again if it would still fit. Only one step is taken per StepInterval,
+// long enough for every plotter to report the effect of the previous step.
+// Plotters are never called back, so the governor's lock nests inside theirs.
+class HistoryGovernor
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t DefaultBudgetBytes = size_t(2048) << 20;
+    static constexpr auto StepInterval = std::chrono::milliseconds(2500);
+    static constexpr double RestoreRatio = 0.6;  // Of the budget, with the restored plotter's bytes doubled
+
+    struct Report
+    {
+        size_t bytes = 0;          // Committed history bytes of the plotter
+        Clock::time_point lastViewed;
+        int maxLevel = 0;          // Deepest level the plotter's settings allow
+    };
+
+    static HistoryGovernor& instance();
+
+    quint64 registerClient();
+    void unregisterClient(quint64 client);
+
+    void setBudget(size_t bytes);  // 0: unlimited
+    size_t budget() const;
+
+    // Store the client's report and rebalance; returns the level the client should apply
+    int report(quint64 client, const Report& report);
+
+private:
+    struct Client
+    {
+        Report report;
+        int level = 0;
+    };
+
+    void rebalance(Clock::time_point now);  // Called with mutex held
+
+    mutable std::mutex mutex;
+    std::map<quint64, Client> clients;
+    quint64 nextClient = 1;
+    size_t budgetBytes = DefaultBudgetBytes;
+    Clock::time_point lastStep;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,31 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq/input_port_ptr.h>
+#include <functional>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Custom hash for InputPortPtr based on underlying object pointer
+struct InputPortHash
+{
+    std::size_t operator()(const daq::InputPortPtr& port) const
+    {
+        return std::hash<void*>{}(port.getObject());
+    }
+};
+
+// Custom equality for InputPortPtr
+struct InputPortEqual
+{
+    bool operator()(const daq::InputPortPtr& lhs, const daq::InputPortPtr& rhs) const
+    {
+        return lhs.getObject() == rhs.getObject();
+    }
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
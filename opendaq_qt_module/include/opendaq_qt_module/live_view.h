@@ -0,0 +1,83 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QPointer>
+#include <QtGlobal>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+QT_BEGIN_NAMESPACE
+class QTimer;
+class QWidget;
+QT_END_NAMESPACE
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Acquisition thread and GUI handoff of a live view function block, the way the plotter
+// runs them. `onAcquire` runs on a thread of its own whenever packets arrive or settings
+// change, paced to MaxFps and backing off when frames get expensive; while the widget
+// is hidden it only runs to drain the readers. Frames are announced to the GUI thread,
+// through the application's frame clock if there is one, where `onRender` picks them up.
+class LiveView
+{
+public:
+    LiveView(std::function<void()> onAcquire, std::function<void()> onRender);
+    ~LiveView();
+
+    LiveView(const LiveView&) = delete;
+    LiveView& operator=(const LiveView&) = delete;
+
+    void start();
+    void stop();  // Joins the acquisition thread; before the state `onAcquire` uses goes away
+
+    // Any thread
+    void wake();
+    void packetReceived();  // One wake-up covers everything queued until the next frame
+    void invalidate();      // Something besides data changed: the next acquire builds a frame
+    void setMaxFps(int fps);
+
+    // Acquisition thread
+    bool takeInvalidated();  // True once after invalidate or after becoming visible
+    bool visible() const { return viewVisible; }
+    void frameReady();       // Schedule `onRender` on the GUI thread
+
+    // GUI thread: frame timer and visibility tracking of the view's widget, again after it was recreated
+    void attach(QWidget* widget);
+    void renderFrame();
+    void setVisible(bool visible);
+
+private:
+    void loop();
+
+    std::function<void()> acquireCallback;
+    std::function<void()> renderCallback;
+
+    std::thread thread;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool stopping = false;  // Guarded by wakeMutex
+    bool pending = false;   // Guarded by wakeMutex
+    std::atomic<bool> dataPending{false};
+    std::atomic<bool> invalidated{true};
+    std::atomic<bool> viewVisible{false};
+    std::atomic<bool> frameNotified{false};
+    std::atomic<int> maxFps{30};
+    std::atomic<qint64> guiFrameCostUs{0};
+
+    QPointer<QObject> visibilityFilter;
+    QPointer<QTimer> updateTimer;
+    std::mutex timerMutex;
+    QTimer* frameTimer = nullptr;   // updateTimer as seen by the acquisition thread, guarded by timerMutex
+    QObject* frameClock = nullptr;  // Application frame clock, if any; guarded by timerMutex
+    QObject* frameView = nullptr;   // Widget as registered with frameClock, guarded by timerMutex
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,256 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/ring_buffer.h>
+#include <QtGlobal>
+#include <algorithm>
+#include <array>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Min/max summary of one aligned block of samples, in the signal's native value type,
+// as it is built and as queries see it
+template <typename ValueT>
+struct MinMaxBucket
+{
+    ValueT minValue = ValueT();
+    ValueT maxValue = ValueT();
+    qint64 minIndex = 0;  // Absolute sample index of the minimum
+    qint64 maxIndex = 0;  // Absolute sample index of the maximum
+};
+
+// Level-of-detail index over a signal history.
+// Level L holds buckets of 2^L samples aligned to absolute sample indices
+// (bucket j covers [j * 2^L, (j + 1) * 2^L)). Buckets are built incrementally
+// as samples are appended and dropped together with the samples they cover,
+// so a range query only touches O(buckets) entries instead of every sample.
+// Stored buckets keep their extremes' positions as 16-bit offsets from the
+// bucket start, so a Float64 bucket takes 20 bytes: about 1.25 bytes per
+// sample at the finest level and 2.5 bytes per sample over all levels.
+template <typename ValueT>
+class MinMaxPyramid
+{
+public:
+    using Bucket = MinMaxBucket<ValueT>;
+
+    static constexpr int MinLevel = 4;   // Finest level: 16 samples per bucket
+    static constexpr int MaxLevel = 16;  // Coarsest level: offsets within a bucket still fit 16 bits
+
+    // Reset; the next appended sample will have absolute index `nextIndex`
+    void clear(qint64 nextIndex)
+    {
+        for (auto& level : levels)
+        {
+            level.extremes.clear();
+            level.offsets.clear();
+            level.firstBucket = 0;
+            level.hasPartial = false;
+        }
+        expectedIndex = nextIndex;
+    }
+
+    void append(qint64 absIndex, ValueT value)
+    {
+        // Non-contiguous input cannot be summarised, start over
+        if (absIndex != expectedIndex)
+            clear(absIndex);
+        expectedIndex = absIndex + 1;
+
+        Bucket sample;
+        sample.minValue = value;
+        sample.maxValue = value;
+        sample.minIndex = absIndex;
+        sample.maxIndex = absIndex;
+        fold(MinLevel, absIndex, absIndex, sample);
+    }
+
+    // Release bucket storage beyond what the remaining buckets need, after the history shrank
+    void shrinkToFit()
+    {
+        for (auto& level : levels)
+        {
+            level.extremes.shrink_to_fit();
+            level.offsets.shrink_to_fit();
+        }
+    }
+
+    size_t memoryBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& level : levels)
+            bytes += level.extremes.capacity() * sizeof(Extremes) + level.offsets.capacity() * sizeof(Offsets);
+        return bytes;
+    }
+
+    // Drop every bucket that covers samples before `firstIndex`
+    void evictBefore(qint64 firstIndex)
+    {
+        for (int l = MinLevel; l <= MaxLevel; ++l)
+        {
+            Level& level = levels[l];
+            size_t drop = 0;
+            while (drop < level.extremes.size() && ((level.firstBucket + static_cast<qint64>(drop)) << l) < firstIndex)
+                ++drop;
+            level.extremes.pop_front(drop);
+            level.offsets.pop_front(drop);
+            level.firstBucket += static_cast<qint64>(drop);
+
+            if (level.hasPartial && level.partialStart < firstIndex)
+                level.hasPartial = false;
+        }
+    }
+
+    // Coarsest level that still yields at least `targetBuckets` buckets over
+    // `sampleCount` samples, or -1 if raw samples should be used
+    int chooseLevel(qint64 sampleCount, qint64 targetBuckets) const
+    {
+        if (targetBuckets <= 0)
+            return -1;
+
+        int chosen = -1;
+        for (int l = MinLevel; l <= MaxLevel; ++l)
+        {
+            if (levels[l].extremes.empty() || (sampleCount >> l) < targetBuckets)
+                break;
+            chosen = l;
+        }
+        return chosen;
+    }
+
+    // Visit [firstIndex, lastIndex] in time order using buckets of `level`
+    // where they exist, refining towards raw samples at the edges.
+    // rawFn(first, last) is called for sample ranges not covered by any bucket,
+    // bucketFn(const Bucket&) for each bucket used, with absolute extreme indices.
+    template <typename RawFn, typename BucketFn>
+    void visit(int level, qint64 firstIndex, qint64 lastIndex, RawFn&& rawFn, BucketFn&& bucketFn) const
+    {
+        if (firstIndex > lastIndex)
+            return;
+
+        if (level < MinLevel)
+        {
+            rawFn(firstIndex, lastIndex);
+            return;
+        }
+
+        const Level& lvl = levels[level];
+        const qint64 bucketSize = qint64(1) << level;
+        qint64 begin = (firstIndex + bucketSize - 1) >> level;
+        qint64 end = ((lastIndex + 1) >> level) - 1;
+        begin = std::max(begin, lvl.firstBucket);
+        end = std::min(end, lvl.firstBucket + static_cast<qint64>(lvl.extremes.size()) - 1);
+
+        if (begin > end)
+        {
+            visit(level - 1, firstIndex, lastIndex, rawFn, bucketFn);
+            return;
+        }
+
+        visit(level - 1, firstIndex, (begin << level) - 1, rawFn, bucketFn);
+        for (qint64 b = begin; b <= end; ++b)
+        {
+            const size_t slot = static_cast<size_t>(b - lvl.firstBucket);
+            const Extremes& extremes = lvl.extremes[slot];
+            const Offsets& offsets = lvl.offsets[slot];
+            Bucket bucket;
+            bucket.minValue = extremes.minValue;
+            bucket.maxValue = extremes.maxValue;
+            bucket.minIndex = (b << level) + offsets.minOffset;
+            bucket.maxIndex = (b << level) + offsets.maxOffset;
+            bucketFn(bucket);
+        }
+        visit(level - 1, (end + 1) << level, lastIndex, rawFn, bucketFn);
+    }
+
+private:
+    struct Extremes
+    {
+        ValueT minValue;
+        ValueT maxValue;
+    };
+
+    // Positions of the extremes relative to the bucket start; kept apart from
+    // the values so they do not pad a bucket up to the value alignment
+    struct Offsets
+    {
+        quint16 minOffset;
+        quint16 maxOffset;
+    };
+    static_assert((qint64(1) << MaxLevel) - 1 <= 0xFFFF, "bucket offsets must fit 16 bits");
+
+    struct Level
+    {
+        RingBuffer<Extremes> extremes;
+        RingBuffer<Offsets> offsets;
+        qint64 firstBucket = 0;      // Bucket number of extremes[0] and offsets[0]
+        Bucket partial;              // Bucket under construction
+        qint64 partialStart = 0;     // First absolute sample index in partial
+        bool hasPartial = false;
+    };
+
+    static void merge(Bucket& into, const Bucket& from)
+    {
+        // Strict comparisons keep the earliest extreme, like the raw MinMax scan
+        if (from.minValue < into.minValue)
+        {
+            into.minValue = from.minValue;
+            into.minIndex = from.minIndex;
+        }
+        if (from.maxValue > into.maxValue)
+        {
+            into.maxValue = from.maxValue;
+            into.maxIndex = from.maxIndex;
+        }
+    }
+
+    // Fold a block covering [first, last] into level l, cascading completed buckets upwards
+    void fold(int l, qint64 first, qint64 last, const Bucket& block)
+    {
+        if (l > MaxLevel)
+            return;
+
+        Level& level = levels[l];
+        if (!level.hasPartial)
+        {
+            level.partial = block;
+            level.partialStart = first;
+            level.hasPartial = true;
+        }
+        else
+        {
+            merge(level.partial, block);
+        }
+
+        const qint64 bucketSize = qint64(1) << l;
+        if (((last + 1) & (bucketSize - 1)) != 0)
+            return;
+
+        // Bucket boundary reached; keep it only if it saw every sample it covers
+        level.hasPartial = false;
+        const qint64 bucketStart = last + 1 - bucketSize;
+        if (level.partialStart != bucketStart)
+            return;
+
+        const qint64 bucketNumber = bucketStart >> l;
+        if (level.extremes.empty() || level.firstBucket + static_cast<qint64>(level.extremes.size()) != bucketNumber)
+        {
+            level.extremes.clear();
+            level.offsets.clear();
+            level.firstBucket = bucketNumber;
+        }
+        level.extremes.push_back({level.partial.minValue, level.partial.maxValue});
+        level.offsets.push_back({static_cast<quint16>(level.partial.minIndex - bucketStart),
+                                 static_cast<quint16>(level.partial.maxIndex - bucketStart)});
+
+        fold(l + 1, bucketStart, last, level.partial);
+    }
+
+    std::array<Level, MaxLevel + 1> levels;
+    qint64 expectedIndex = 0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,61 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+#include <memory>
+#include <string>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+class SharedHistory;
+
+// What the chart currently shows; published by the GUI thread to the acquisition thread
+struct PlotView
+{
+    bool followLatest = true;   // Auto-follow: show the last Duration seconds of data
+    double visibleMin = 0.0;    // Visible range (ms since epoch) when not following
+    double visibleMax = 0.0;
+    qreal pixelWidth = 0.0;     // Plot area width, target for level-of-detail
+    quint64 generation = 0;     // Bumped on every change
+};
+
+// Ready-to-draw state of one signal
+struct SignalFrame
+{
+    quint64 signalId = 0;
+    std::string caption;
+    qint64 dataMinTime = 0;
+    qint64 dataMaxTime = 0;
+    bool hasData = false;
+    QVector<QPointF> points;    // Already downsampled for the frame's visible range
+    std::shared_ptr<SharedHistory> history;  // Full resolution, for cursor measurements on the GUI thread
+    quint64 subscriber = 0;                  // The plotter's key in `history`
+};
+
+// One frame for all connected signals of a plotter, published by the acquisition thread
+struct PlotFrame
+{
+    std::vector<SignalFrame> signalFrames;
+
+    bool hasData = false;
+    bool followLatest = true;
+    double visibleMin = 0.0;    // Range the points were built for
+    double visibleMax = 0.0;
+
+    // Y-axis range when AutoScale is enabled
+    bool autoScale = false;
+    double valueMin = 0.0;
+    double valueMax = 0.0;
+
+    bool removeDisconnectedSeries = true;  // AutoClear
+    bool rasterRenderer = false;           // Renderer: draw with RasterSeriesItem instead of QLineSeries points
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
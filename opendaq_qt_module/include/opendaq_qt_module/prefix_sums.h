@@ -0,0 +1,148 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/ring_buffer.h>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Count, extremes and sums of the samples in a time range
+struct RangeStatistics
+{
+    qint64 count = 0;
+    double min = std::numeric_limits<double>::quiet_NaN();
+    double max = std::numeric_limits<double>::quiet_NaN();
+    double sum = 0.0;
+    double sumSquares = 0.0;
+
+    bool isEmpty() const { return count == 0; }
+    double mean() const { return count > 0 ? sum / static_cast<double>(count) : std::numeric_limits<double>::quiet_NaN(); }
+    double rms() const
+    {
+        return count > 0 ? std::sqrt(std::max(sumSquares, 0.0) / static_cast<double>(count)) : std::numeric_limits<double>::quiet_NaN();
+    }
+    double peakToPeak() const { return max - min; }
+};
+
+// Running sums of values and squared values over a signal history, for range sums in O(1).
+// The cumulative sums are recorded at every block boundary of absolute sample index
+// (a multiple of BlockSize), so they cost two doubles per block instead of per sample.
+// A range sum is the difference of the boundaries inside the range plus the fewer than
+// BlockSize samples at each edge, which the caller adds from the raw samples.
+// Accumulation is compensated (Kahan), so long histories keep their precision.
+// Like MinMaxPyramid, boundaries are dropped with the samples they follow.
+template <typename ValueT>
+class PrefixSums
+{
+public:
+    static constexpr int BlockShift = 4;  // 16 samples per block, like the finest pyramid level
+    static constexpr qint64 BlockSize = qint64(1) << BlockShift;
+
+    struct Sums
+    {
+        double sum = 0.0;
+        double sumSquares = 0.0;
+    };
+
+    // Reset; the next appended sample will have absolute index `nextIndex`
+    void clear(qint64 nextIndex)
+    {
+        boundaries.clear();
+        firstBoundary = 0;
+        running = {};
+        compensation = {};
+        expectedIndex = nextIndex;
+    }
+
+    void append(qint64 absIndex, ValueT value)
+    {
+        // Non-contiguous input has no common origin, start over
+        if (absIndex != expectedIndex)
+            clear(absIndex);
+        expectedIndex = absIndex + 1;
+
+        if ((absIndex & (BlockSize - 1)) == 0)
+        {
+            const qint64 boundary = absIndex >> BlockShift;
+            if (boundaries.empty())
+                firstBoundary = boundary;
+            boundaries.push_back(running);
+        }
+
+        const double x = static_cast<double>(value);
+        add(running.sum, compensation.sum, x);
+        add(running.sumSquares, compensation.sumSquares, x * x);
+    }
+
+    // Drop the boundaries before `firstIndex`; no range starting there can use them
+    void evictBefore(qint64 firstIndex)
+    {
+        size_t drop = 0;
+        while (drop < boundaries.size() && ((firstBoundary + static_cast<qint64>(drop)) << BlockShift) < firstIndex)
+            ++drop;
+        boundaries.pop_front(drop);
+        firstBoundary += static_cast<qint64>(drop);
+    }
+
+    void shrinkToFit() { boundaries.shrink_to_fit(); }
+    size_t memoryBytes() const { return boundaries.capacity() * sizeof(Sums); }
+
+    // Sums of the whole blocks in [firstIndex, lastIndex]. `blockFirst` and `blockLast` get the
+    // covered sample range; blockFirst > blockLast if no whole block is covered.
+    Sums blocks(qint64 firstIndex, qint64 lastIndex, qint64& blockFirst, qint64& blockLast) const
+    {
+        const qint64 begin = (firstIndex + BlockSize - 1) >> BlockShift;
+        const qint64 end = (lastIndex + 1) >> BlockShift;
+
+        Sums atBegin;
+        Sums atEnd;
+        if (begin >= end || !sumsAt(begin, atBegin) || !sumsAt(end, atEnd))
+        {
+            blockFirst = firstIndex;
+            blockLast = firstIndex - 1;
+            return {};
+        }
+
+        blockFirst = begin << BlockShift;
+        blockLast = (end << BlockShift) - 1;
+        return {atEnd.sum - atBegin.sum, atEnd.sumSquares - atBegin.sumSquares};
+    }
+
+private:
+    static void add(double& total, double& carry, double x)
+    {
+        const double y = x - carry;
+        const double t = total + y;
+        carry = (t - total) - y;
+        total = t;
+    }
+
+    // Sums of everything before boundary `boundary`; the boundary after the newest sample is the running sum
+    bool sumsAt(qint64 boundary, Sums& sums) const
+    {
+        if ((boundary << BlockShift) == expectedIndex)
+        {
+            sums = running;
+            return true;
+        }
+        if (boundary < firstBoundary || boundary >= firstBoundary + static_cast<qint64>(boundaries.size()))
+            return false;
+        sums = boundaries[static_cast<size_t>(boundary - firstBoundary)];
+        return true;
+    }
+
+    RingBuffer<Sums> boundaries;
+    qint64 firstBoundary = 0;  // Boundary number of boundaries[0]
+    Sums running;              // Sums of every sample since the origin
+    Sums compensation;
+    qint64 expectedIndex = 0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
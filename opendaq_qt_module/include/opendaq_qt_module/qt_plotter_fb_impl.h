@@ -1,19 +1,38 @@
 #pragma once
 #include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/downsampling.h>
+#include <opendaq_qt_module/frame_allocations.h>
+#include <opendaq_qt_module/history_cache.h>
+#include <opendaq_qt_module/history_governor.h>
+#include <opendaq_qt_module/input_port_hash.h>
+#include <opendaq_qt_module/plot_frame.h>
+#include <opendaq_qt_module/raster_series_item.h>
+#include <opendaq_qt_module/signal_path.h>
+#include <opendaq_qt_module/trigger.h>
+#include <opendaq_qt_module/triple_buffer.h>
+#include <opendaq_qt_module/worker_pool.h>
 #include <qt_widget_interface/qt_widget_interface.h>
 #include <opendaq/function_block_impl.h>
 #include <opendaq/function_block_type_factory.h>
 #include <opendaq/signal_ptr.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/reader_factory.h>
-#include <opendaq/time_reader.h>
 #include <QWidget>
 #include <QPointer>
 #include <QPoint>
 #include <QVector>
 #include <QtGlobal>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QScatterSeries>
 
@@ -31,15 +50,6 @@ BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
 namespace QtPlotter
 {
 
-// Downsampling methods for high-frequency signals
-enum class DownsampleMethod
-{
-    None = 0,    // No downsampling - show all points (may be slow)
-    Simple = 1,  // Take every Nth point
-    MinMax = 2,  // Keep min and max in each bucket (preserves peaks)
-    LTTB = 3     // Largest Triangle Three Buckets (best visual quality)
-};
-
 // Line style for signal rendering
 enum class LineStyle
 {
@@ -48,6 +58,13 @@ enum class LineStyle
     Dotted = 2   // Dotted line
 };
 
+// How signal points are drawn
+enum class RenderBackend
+{
+    Series = 0,  // QLineSeries points (default)
+    Raster = 1   // RasterSeriesItem: cached QPainter raster, series keep only legend and axes
+};
+
 // Forward declarations
 class QtPlotterFbImpl;
 
@@ -72,12 +89,29 @@ private:
     int m_draggedMarkerIndex;  // Index of marker being dragged
 };
 
+// Tracks whether the plot widget is on screen (tab shown, window not minimised)
+class VisibilityEventFilter : public QObject
+{
+    Q_OBJECT
+public:
+    VisibilityEventFilter(QWidget* widget, QtPlotterFbImpl* plotter);
+    ~VisibilityEventFilter() override;
+
+    void detach();  // Plotter is going away
+
+protected:
+    bool eventFilter(QObject* obj, QEvent* event) override;
+
+private:
+    QtPlotterFbImpl* m_plotter;
+};
+
 struct SignalContext
 {
     daq::InputPortPtr inputPort;
+    quint64 id;  // Stable key of this signal in published frames
 
-    daq::StreamReaderPtr streamReader;
-    daq::TimeReader<daq::StreamReaderPtr> timeReader;
+    daq::StreamReaderPtr streamReader;  // Drains the port for its descriptor events; `history` reads the samples
 
     std::string caption;
     bool isSignalConnected;
@@ -86,52 +120,76 @@ struct SignalContext
     double valueRangeMin;
     double valueRangeMax;
 
+    // Sample rate from the domain descriptor's linear rule (0 if unknown)
+    double sampleRate;
+
     // Time range of data in series (for fast visible range check)
     qint64 dataMinTime;
     qint64 dataMaxTime;
 
-    // Direct pointer to the series for this signal (avoids O(n*m) lookup)
-    QPointer<QLineSeries> series;
+    // Circular history of the last DurationHistory seconds in the native sample types
+    // of the signal's descriptor, read once for every plotter showing the signal
+    std::shared_ptr<SharedHistory> history;
+    quint64 subscriber;  // Key of this signal context in `history`
+    std::string signalId;  // Global id of the signal `history` keeps, empty before the first connection
+    quint64 historyVersion = 0;  // history->version() as of the last acquire
+
+    bool newData = false;  // Samples were stored since the last acquire
 
-    // Reusable buffer for QPointF to avoid allocations
-    QVector<QPointF> pointsBuffer;
+    // Points of the last frame; coarse after a zoom/pan until refined (acquisition thread).
+    // Rebuilt in place, so it keeps its capacity from frame to frame.
+    QVector<QPointF> points;
+    bool pointsRefined = false;
 
-    SignalContext(const daq::InputPortPtr& port)
+    SignalContext(const daq::InputPortPtr& port, quint64 id)
         : inputPort(port)
+        , id(id)
         , streamReader(daq::StreamReaderFromPort(port, daq::SampleType::Float64, daq::SampleType::Int64))
-        , timeReader(streamReader)
         , isSignalConnected(false)
         , valueRangeMin(0.0)
         , valueRangeMax(0.0)
+        , sampleRate(0.0)
         , dataMinTime(0)
         , dataMaxTime(0)
-        , series(nullptr)
+        , history(std::make_shared<SharedHistory>())
+        , subscriber(HistoryCache::newSubscriber())
     {
-        pointsBuffer.reserve(200);
+        // Own history until a signal is connected
+        history->subscribe(subscriber);
     }
-};
 
-// Custom hash for InputPortPtr based on underlying object pointer
-struct InputPortHash
-{
-    std::size_t operator()(const daq::InputPortPtr& port) const
+    ~SignalContext()
     {
-        return std::hash<void*>{}(port.getObject());
+        history->unsubscribe(subscriber);
     }
 };
 
-// Custom equality for InputPortPtr
-struct InputPortEqual
+// Properties the acquisition thread works with, copied under the config lock at the start of each frame
+struct AcquisitionSettings
 {
-    bool operator()(const daq::InputPortPtr& lhs, const daq::InputPortPtr& rhs) const
-    {
-        return lhs.getObject() == rhs.getObject();
-    }
+    double duration = 0.0;
+    double durationHistory = 0.0;
+    bool autoScale = false;
+    bool autoClear = false;
+    double defaultMinY = 0.0;
+    double defaultMaxY = 0.0;
+    DownsampleMethod downsampleMethod = DownsampleMethod::MinMax;
+    size_t maxSamplesPerSeries = 0;
+    RenderBackend renderBackend = RenderBackend::Series;
+    Int diskBudgetMb = 0;
+    bool storageDecimation = false;
+    TriggerMode triggerMode = TriggerMode::Off;
+    TriggerEdge triggerEdge = TriggerEdge::Rising;
+    double triggerLevel = 0.0;
+    Int triggerSource = 0;
+    double preTrigger = 0.0;
+    double postTrigger = 0.0;
 };
 
 class QtPlotterFbImpl : public daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>
 {
     friend class ChartEventFilter;
+    friend class VisibilityEventFilter;
     using Super = daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>;
 
 public:
@@ -140,10 +198,13 @@ public:
                              const daq::StringPtr& localId,
                              const daq::PropertyObjectPtr& config = nullptr);
 
+    ~QtPlotterFbImpl() override;
+
     static daq::FunctionBlockTypePtr CreateType();
 
     void onConnected(const daq::InputPortPtr& inputPort) override;
     void onDisconnected(const daq::InputPortPtr& inputPort) override;
+    void onPacketReceived(const daq::InputPortPtr& port) override;
 
     // Implement IQTWidget interface
     void initWidget();
@@ -160,43 +221,63 @@ private:
     void propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value);
 
     void updateInputPorts();
-
+    AcquisitionSettings acquisitionSettings() const;
+
+    // Acquisition thread: drains readers, maintains history and publishes downsampled frames
+    void startAcquisition();
+    void stopAcquisition();
+    void acquisitionLoop();
+    void acquire();
+    void applyConfigChanges();  // Connections and property changes since the last frame; under the config lock
+    void readSignal(SignalContext& sigCtx);  // Drain the port, handle its events and read the history; runs on the worker pool
+    void reportFrameTime(std::chrono::steady_clock::duration frameTime);
+    void governHistory();  // Report history memory to the HistoryGovernor and apply the level it returns
+    bool updateTrigger();  // Search the trigger source's new samples; true once a new capture is complete
+    void rearmTrigger();
+    SignalContext* triggerSourceSignal() const;
+    void wakeAcquisition();
+    void notifyFrameReady();  // Schedule updatePlot on the GUI thread
+
+    // GUI thread: publish the chart's view and apply the latest frame
+    void publishView();
     void updatePlot();
-    void createSeriesForSignal(SignalContext& sigCtx);  // Create and configure QLineSeries for a signal
+    void setPlotVisible(bool visible);
+    QLineSeries* createSeriesForSignal(const SignalFrame& signalFrame);  // Create and configure QLineSeries for a signal
+    QLineSeries* seriesForSignal(const SignalContext& sigCtx) const;  // Series drawn for a signal, nullptr if none
     void updateSeriesLineStyle();  // Update line style for all series
     Qt::PenStyle getQtPenStyle() const;  // Convert LineStyle enum to Qt::PenStyle
     void handleEventPacket(SignalContext& sigCtx, const daq::EventPacketPtr& eventPacket);  // Handle event packets (e.g., DATA_DESCRIPTOR_CHANGED)
-    bool handleData(SignalContext& sigCtx, QLineSeries* series, size_t count, qint64& outLatestTime);  // Handle data reading, processing, and series update
+    bool handleData(SignalContext& sigCtx, qint64& outLatestTime);  // Data time range after a read
     
     // Marker methods
     void addMarkerAtTime(qint64 timeMsec);
     void updateMarkers();
     void removeMarker(int index);
     void moveMarker(int index, qint64 newTimeMsec);
+    void updateMeasurement();  // Statistics between the first two markers
     int findMarkerAtPosition(const QPointF& scenePos, qreal tolerance = 10.0);
     bool isDeleteButtonAtPosition(int markerIndex, const QPointF& scenePos);
     void showDeleteButton(int markerIndex);
     void hideDeleteButtons();
-    double getSignalValueAtTime(QLineSeries* series, qint64 timeMsec);
+    double getSignalValueAtTime(const SignalContext& sigCtx, qint64 timeMsec) const;
     QPointF constrainLabelPosition(const QPointF& pos, const QRectF& labelRect, const QRectF& plotArea);
 
-    // Lazy rendering methods - work with visible points only
-    std::pair<int, int> getVisibleRange(const SignalContext& sigCtx, qint64 visibleMin, qint64 visibleMax) const;
-    void updateVisibleSeries(SignalContext& sigCtx, QLineSeries* series, qint64 visibleMin, qint64 visibleMax);
-    
-    // Binary search helpers for sorted QPointF vectors (sorted by x coordinate)
-    int binarySearchFirstGE(const QVector<QPointF>& points, qint64 targetTime) const;
-    int binarySearchLastLE(const QVector<QPointF>& points, qint64 targetTime, int startIdx = 0) const;
-    
-    // Downsampling methods for visible points (work with indices in pointsBuffer)
-    QVector<QPointF> downsampleVisibleNone(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx) const;
-    QVector<QPointF> downsampleVisibleSimple(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx, size_t targetPoints) const;
-    QVector<QPointF> downsampleVisibleMinMax(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx, size_t targetPoints) const;
-    QVector<QPointF> downsampleVisibleLTTB(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx, size_t targetPoints) const;
+    void reserveHistory(SignalContext& sigCtx) const;  // Size history store from DurationHistory and sample rate
+    double effectiveHistory() const;  // DurationHistory as shortened by the history governor
+    int maxHistoryLevel() const;      // Deepest governor level that keeps at least Duration of history
+    void configureSpill();  // Apply DiskBudget to all signals; under the config lock
+    void configureSpill(SignalContext& sigCtx) const;
+    void configureDecimation(SignalContext& sigCtx, qreal pixelWidth) const;  // Apply StorageDecimation for the plot width
+    void buildSignalPoints(SignalContext& sigCtx, const VisibleRequest& request) const;
+    void fillSignalFrame(const SignalContext& sigCtx, SignalFrame& signalFrame) const;
+    void refineSignals(PlotFrame& frame, const VisibleRequest& request, quint64 viewGeneration);  // One time-budgeted slice
+
+    qreal plotPixelWidth() const;  // Plot area width in pixels, target for level-of-detail
 
 private:
     std::unordered_map<daq::InputPortPtr, SignalContext, InputPortHash, InputPortEqual> signalContexts;
     size_t inputPortCount;
+    quint64 nextSignalId{1};
 
     // Properties
     double duration;  // Time window to display in seconds
@@ -210,6 +291,16 @@ private:
     DownsampleMethod downsampleMethod;  // Downsampling algorithm to use
     size_t maxSamplesPerSeries;  // Maximum number of points to keep per series
     LineStyle lineStyle;  // Line style for signal rendering (solid, dashed, dotted)
+    RenderBackend renderBackend;  // QLineSeries or raster rendering
+    std::atomic<Int> maxFps{30};  // Frame rate cap
+    Int diskBudgetMb{0};  // Disk space for scrollback beyond DurationHistory, 0 = memory only
+    bool storageDecimation{false};  // Fold samples into bins before storing them
+    TriggerMode triggerMode{TriggerMode::Off};
+    TriggerEdge triggerEdge{TriggerEdge::Rising};
+    double triggerLevel{0.0};
+    Int triggerSource{0};    // Index of the triggering signal, in connection order
+    double preTrigger{0.1};  // Seconds of a capture before the trigger point
+    double postTrigger{0.4};  // Seconds of a capture after the trigger point
     size_t seriesIndex{0};  // Series index for new signals
 
     // Qt Widget
@@ -222,25 +313,83 @@ private:
     // Widget for embedding in tabs
     QPointer<QWidget> embeddedWidget;
     
-    // Update timer for plot
+    QPointer<VisibilityEventFilter> visibilityFilter;
+
+    // Single-shot timer that runs updatePlot once a frame is ready, without a frame clock
     QPointer<QTimer> updateTimer;
     
-    // Timer for debouncing visible series updates during zoom/pan
-    QPointer<QTimer> visibleUpdateTimer;
-    qint64 pendingVisibleMin = 0;
-    qint64 pendingVisibleMax = 0;
-    
-    // Temporary storage for original values during zoom
-    bool isZooming = false;
+    bool updatingAxisRange = false;  // Range changes made by auto-follow are not user zoom
+
+    // Series of each signal by SignalContext::id (GUI thread only)
+    std::unordered_map<quint64, QPointer<QLineSeries>> seriesById;
+    std::unordered_map<quint64, std::string> seriesCaptions;  // Caption each series was last named from
+
+    // Raster render backend, created on first use (GUI thread only)
+    QPointer<RasterSeriesItem> rasterItem;
+    bool rasterActive = false;
+
+    // Acquisition thread and its handoff to the GUI thread
+    std::thread acquisitionThread;
+    std::mutex acquisitionMutex;
+    std::condition_variable acquisitionWake;
+    bool acquisitionStopping = false;  // Guarded by acquisitionMutex
+    bool acquisitionPending = false;   // Guarded by acquisitionMutex
+    std::atomic<bool> clearRequested{false};
+    std::atomic<bool> dataPending{false};       // Packets arrived since the last acquire
+    std::atomic<bool> plotVisible{false};       // No frames are built while the plot is not on screen
+    std::atomic<bool> frameNotified{false};     // updatePlot already scheduled
+    std::atomic<qint64> guiFrameCostUs{0};      // Cost of the last updatePlot, for frame pacing
+    std::mutex frameTimerMutex;
+    QTimer* frameTimer = nullptr;               // updateTimer as seen by the acquisition thread, guarded by frameTimerMutex
+    QObject* frameClock = nullptr;              // Application frame clock, if any; guarded by frameTimerMutex
+    QObject* frameView = nullptr;               // embeddedWidget as registered with frameClock, guarded by frameTimerMutex
+
+    TripleBuffer<PlotView> viewBuffer;    // GUI -> acquisition
+    TripleBuffer<PlotFrame> frameBuffer;  // Acquisition -> GUI
+    PlotView currentView;                 // GUI side copy of the last published view
+    quint64 renderedViewGeneration = 0;   // Acquisition side
+    std::atomic<quint64> publishedViewGeneration{0};  // Latest view of the GUI, cancels refinement
+    std::atomic<bool> framesDirty{true};  // Something besides data changed
+
+    // Per-signal work of a frame is spread over the pool; the acquisition thread joins in
+    std::shared_ptr<WorkerPool> workerPool = WorkerPool::shared();
+    std::vector<SignalContext*> activeSignals;  // Connected signals of the current acquire
+    std::vector<size_t> refinePending;          // refineSignals scratch, kept between frames
+
+    // Reads and downsampling run without the config lock: they use a copy of the properties,
+    // and the signal contexts of the frame, which change only while acquire holds the lock.
+    // Connections and property changes are queued for the next frame (config lock).
+    AcquisitionSettings settings;  // Acquisition thread
+    std::vector<std::pair<daq::InputPortPtr, daq::SignalPtr>> portChanges;  // Connected signal, nullptr if disconnected
+    bool historyStale = false;  // History length settings changed
+    bool spillStale = false;    // DiskBudget changed
+    bool rearmPending = false;  // Trigger settings changed
+
+    // Trigger state (acquisition thread); times in ms like the history
+    double triggerSearchFrom = std::numeric_limits<double>::quiet_NaN();  // Samples after it are not searched yet; NaN: arm at the newest
+    double pendingTrigger = std::numeric_limits<double>::quiet_NaN();     // Trigger point waiting for its post-trigger samples
+    double captureTime = std::numeric_limits<double>::quiet_NaN();        // Trigger point of the capture on screen
+    double lastCaptureData = 0.0;  // Newest sample time when the last capture completed, for Auto
+    bool triggerStopped = false;   // Single capture taken
+
+    // Share of the process-wide history memory budget, see HistoryGovernor
+    quint64 governorClient = HistoryGovernor::instance().registerClient();
+    int historyLevel = 0;  // Degradation the governor asked for
+    std::atomic<Int> shownBudgetMb{static_cast<Int>(HistoryGovernor::instance().budget() >> 20)};  // HistoryBudget as last shown or written
+    std::chrono::steady_clock::time_point lastViewed = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point historyReported;
+
+    // FrameTime statistic: average acquisition thread time per built frame
+    std::chrono::steady_clock::duration frameTimeSum{};
+    int frameTimeCount = 0;
+    std::chrono::steady_clock::time_point frameTimeReported;
+    quint64 steadyFrameAllocations = 0;  // Debug builds: buffer reallocations in frames without view changes
     
     // Screen aspect ratio for proportional zooming
     // Stores the ratio: (plotArea.width / timeRange) / (plotArea.height / yRange)
     // This maintains the visual aspect ratio when zooming
     qreal screenAspectRatio = 1.0;  // Initialized to 1.0, will be calculated on first zoom
 
-    std::vector<double> samples;
-    std::vector<std::chrono::system_clock::time_point> timeStamps;
-    
     // Markers (vertical lines with value annotations)
     struct Marker
     {
@@ -254,6 +403,7 @@ private:
         QPointer<QGraphicsTextItem> deleteButton;  // Delete button (X) shown on hover
     };
     QList<Marker> markers;
+    QPointer<QGraphicsTextItem> measurementLabel;  // Two-cursor measurement, top left of the plot area
 };
 
 }  // namespace QtPlotter
@@ -0,0 +1,142 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/input_port_hash.h>
+#include <opendaq_qt_module/live_view.h>
+#include <opendaq_qt_module/spectrum_analyzer.h>
+#include <opendaq_qt_module/spectrum_signal.h>
+#include <opendaq_qt_module/triple_buffer.h>
+#include <opendaq_qt_module/worker_pool.h>
+#include <qt_widget_interface/qt_widget_interface.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/function_block_type_factory.h>
+#include <QPointer>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+class QChart;
+class QChartView;
+class QLineSeries;
+class QValueAxis;
+class QWidget;
+QT_END_NAMESPACE
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+enum class SpectrumScale
+{
+    Decibel = 0,  // 20 log10 of the amplitude
+    Linear = 1    // Amplitude in the signal's unit
+};
+
+// Ready-to-draw spectrum of one signal
+struct SpectrumSignalFrame
+{
+    quint64 signalId = 0;
+    std::string caption;
+    QVector<QPointF> points;  // (frequency, value), at most two per pixel column
+};
+
+// One frame for all connected signals of a spectrum view, published by the acquisition thread
+struct SpectrumFrame
+{
+    std::vector<SpectrumSignalFrame> signalFrames;
+    bool hasData = false;
+    double maxFrequency = 0.0;  // Nyquist frequency of the fastest signal, or bins if no rate is known
+    bool frequencyKnown = false;
+    bool decibel = true;        // Scale of the values
+    double valueMin = 0.0;
+    double valueMax = 0.0;
+};
+
+// Live FFT view of its input signals: windowed, overlapping blocks are transformed with
+// the in-tree RealFft and averaged on the acquisition thread; the GUI only draws the
+// published spectra, reduced to the plot's pixel columns.
+class QtSpectrumFbImpl : public daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>
+{
+    using Super = daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>;
+
+public:
+    explicit QtSpectrumFbImpl(const daq::ContextPtr& ctx,
+                              const daq::ComponentPtr& parent,
+                              const daq::StringPtr& localId,
+                              const daq::PropertyObjectPtr& config = nullptr);
+
+    ~QtSpectrumFbImpl() override;
+
+    static daq::FunctionBlockTypePtr CreateType();
+
+    void onConnected(const daq::InputPortPtr& inputPort) override;
+    void onDisconnected(const daq::InputPortPtr& inputPort) override;
+    void onPacketReceived(const daq::InputPortPtr& port) override;
+
+    // Implement IQTWidget interface
+    ErrCode getWidget(struct QWidget** widget) override;
+
+private:
+    void initProperties();
+    void propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value);
+    void updateInputPorts();
+    SpectrumSettings spectrumSettings() const;
+
+    // Acquisition thread
+    void acquire();
+    void readSignal(SpectrumSignal& signal, bool analyse);  // Runs on the worker pool
+    void buildSignalFrame(const SpectrumSignal& signal, SpectrumSignalFrame& signalFrame, qreal pixelWidth) const;
+    void reportFrameTime(std::chrono::steady_clock::duration frameTime);
+
+    // GUI thread
+    void createWidget();
+    void updatePlot();
+
+private:
+    std::unordered_map<daq::InputPortPtr, SpectrumSignal, InputPortHash, InputPortEqual> spectrumSignals;
+    size_t inputPortCount = 0;
+    quint64 nextSignalId{1};
+
+    // Properties
+    size_t fftSize = 4096;
+    SpectrumWindow window = SpectrumWindow::Hann;
+    double overlap = 50.0;  // Percent
+    SpectrumAveraging averaging = SpectrumAveraging::None;
+    Int averageCount = 10;
+    SpectrumScale scale = SpectrumScale::Decibel;
+    bool autoScale = true;
+    double defaultMinY = -140.0;  // Y-axis range without AutoScale
+    double defaultMaxY = 20.0;
+    bool showLegend = true;
+    bool showGrid = true;
+
+    // Qt Widget
+    QPointer<QWidget> embeddedWidget;
+    QPointer<QChart> chart;
+    QPointer<QValueAxis> axisX;
+    QPointer<QValueAxis> axisY;
+    std::unordered_map<quint64, QPointer<QLineSeries>> seriesById;  // GUI thread only
+    std::atomic<qreal> plotWidth{0.0};  // Plot area width in pixels, published by the GUI thread
+
+    LiveView liveView;
+    std::shared_ptr<WorkerPool> workerPool = WorkerPool::shared();
+    TripleBuffer<SpectrumFrame> frameBuffer;  // Acquisition -> GUI
+    std::vector<SpectrumSignal*> activeSignals;  // Connected signals of the current acquire
+    std::atomic<bool> resetRequested{false};
+
+    // FrameTime statistic: average acquisition thread time per built frame
+    std::chrono::steady_clock::duration frameTimeSum{};
+    int frameTimeCount = 0;
+    std::chrono::steady_clock::time_point frameTimeReported;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
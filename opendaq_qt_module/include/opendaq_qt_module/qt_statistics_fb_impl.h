@@ -0,0 +1,173 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/input_port_hash.h>
+#include <opendaq_qt_module/live_view.h>
+#include <opendaq_qt_module/running_statistics.h>
+#include <opendaq_qt_module/triple_buffer.h>
+#include <opendaq_qt_module/worker_pool.h>
+#include <qt_widget_interface/qt_widget_interface.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/function_block_type_factory.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/signal_config_ptr.h>
+#include <QPointer>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+class QChart;
+class QLineSeries;
+class QTableWidget;
+class QValueAxis;
+class QWidget;
+QT_END_NAMESPACE
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+enum class StatisticsWindow
+{
+    Sliding = 0,     // The last SlidingWindow seconds
+    Cumulative = 1   // Everything since the connection or the last reset
+};
+
+// Input signal of a statistics view, with the output signals its statistics are published on
+struct StatisticsSignal
+{
+    daq::InputPortPtr inputPort;
+    quint64 id;  // Stable key of this signal in published frames
+    daq::StreamReaderPtr streamReader;
+
+    std::string caption;
+    bool isSignalConnected = false;
+
+    RunningStatistics statistics;
+    std::vector<double> valueBuffer;  // Kept between reads
+    std::vector<int64_t> tickBuffer;
+    size_t newSamples = 0;            // Read by the last acquire
+
+    // One output per statistic on an explicit domain holding the tick of the last sample.
+    // Descriptors come from the reader's events and are applied by the acquisition thread.
+    daq::DataDescriptorPtr valueDescriptor;
+    daq::DataDescriptorPtr domainDescriptor;
+    bool outputDescriptorsStale = false;
+    daq::SignalConfigPtr domainOutput;
+    std::vector<daq::SignalConfigPtr> outputs;
+
+    StatisticsSignal(const daq::InputPortPtr& port, quint64 id)
+        : inputPort(port)
+        , id(id)
+        , streamReader(daq::StreamReaderFromPort(port, daq::SampleType::Float64, daq::SampleType::Int64))
+    {
+    }
+};
+
+// Ready-to-draw statistics of one signal
+struct StatisticsSignalFrame
+{
+    quint64 signalId = 0;
+    std::string caption;
+    StatisticsSnapshot statistics;
+    QVector<QPointF> histogram;  // Step outline: (value, share of the samples in percent)
+};
+
+// One frame for all connected signals of a statistics view, published by the acquisition thread
+struct StatisticsFrame
+{
+    std::vector<StatisticsSignalFrame> signalFrames;
+    bool hasHistogram = false;
+    double histogramMin = 0.0;  // Union of the signals' histogram ranges
+    double histogramMax = 0.0;
+    double maxShare = 0.0;      // Highest bin in percent
+};
+
+// Distribution and running statistics of its input signals. Every read block goes
+// through the SIMD moments kernel and is merged into Welford and Kahan accumulators on
+// the acquisition thread; statistics are published as output signals and as read-only
+// properties of the input ports at ReportInterval, whether the view is shown or not.
+class QtStatisticsFbImpl : public daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>
+{
+    using Super = daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>;
+
+public:
+    explicit QtStatisticsFbImpl(const daq::ContextPtr& ctx,
+                                const daq::ComponentPtr& parent,
+                                const daq::StringPtr& localId,
+                                const daq::PropertyObjectPtr& config = nullptr);
+
+    ~QtStatisticsFbImpl() override;
+
+    static daq::FunctionBlockTypePtr CreateType();
+
+    void onConnected(const daq::InputPortPtr& inputPort) override;
+    void onDisconnected(const daq::InputPortPtr& inputPort) override;
+    void onPacketReceived(const daq::InputPortPtr& port) override;
+
+    // Implement IQTWidget interface
+    ErrCode getWidget(struct QWidget** widget) override;
+
+private:
+    void initProperties();
+    void propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value);
+    void updateInputPorts();
+    StatisticsSettings statisticsSettings() const;
+
+    // Acquisition thread
+    void acquire();
+    void readSignal(StatisticsSignal& signal);  // Runs on the worker pool
+    void handleEventPacket(StatisticsSignal& signal, const daq::EventPacketPtr& eventPacket);
+    void createOutputs(StatisticsSignal& signal);
+    void updateOutputDescriptors(StatisticsSignal& signal);
+    void removeOutputs(StatisticsSignal& signal);
+    void report();
+    void buildSignalFrame(const StatisticsSignal& signal, StatisticsSignalFrame& signalFrame) const;
+
+    // GUI thread
+    void createWidget();
+    void updatePlot();
+
+private:
+    std::unordered_map<daq::InputPortPtr, StatisticsSignal, InputPortHash, InputPortEqual> statisticsSignals;
+    size_t inputPortCount = 0;
+    quint64 nextSignalId{1};
+
+    // Properties
+    StatisticsWindow statisticsWindow = StatisticsWindow::Sliding;
+    double slidingWindow = 1.0;  // Seconds
+    Int bins = 64;
+    bool autoRange = true;
+    double histogramMin = -1.0;  // Histogram range without AutoRange
+    double histogramMax = 1.0;
+    double reportInterval = 1.0;  // Seconds between output packets and property updates
+
+    // Qt Widget
+    QPointer<QWidget> embeddedWidget;
+    QPointer<QTableWidget> table;
+    QPointer<QChart> chart;
+    QPointer<QValueAxis> axisX;
+    QPointer<QValueAxis> axisY;
+    std::unordered_map<quint64, QPointer<QLineSeries>> seriesById;  // GUI thread only
+
+    LiveView liveView;
+    std::shared_ptr<WorkerPool> workerPool = WorkerPool::shared();
+    TripleBuffer<StatisticsFrame> frameBuffer;  // Acquisition -> GUI
+    std::vector<StatisticsSignal*> activeSignals;  // Connected signals of the current acquire
+    std::atomic<bool> resetRequested{false};
+    std::chrono::steady_clock::time_point lastReport;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
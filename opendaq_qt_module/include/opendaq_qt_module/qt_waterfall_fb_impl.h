@@ -0,0 +1,128 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/live_view.h>
+#include <opendaq_qt_module/spectrum_analyzer.h>
+#include <opendaq_qt_module/spectrum_signal.h>
+#include <opendaq_qt_module/waterfall_image.h>
+#include <qt_widget_interface/qt_widget_interface.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/function_block_type_factory.h>
+#include <QPointer>
+#include <QWidget>
+#include <QtGlobal>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Draws a WaterfallImage with a frequency scale below it
+class WaterfallWidget : public QWidget
+{
+public:
+    // `onResize` gets the image size in pixels whenever the plot area changes
+    explicit WaterfallWidget(std::function<void(int width, int rows)> onResize, QWidget* parent = nullptr);
+
+    void detach();  // Function block is going away
+
+    WaterfallImage& image() { return waterfall; }
+    void setFrequencyRange(double maxFrequency, bool known);
+    void setTimeSpan(double seconds);  // Time from the top to the bottom row, 0 if unknown
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+
+private:
+    QRect plotRect() const;
+
+    std::function<void(int, int)> resized;
+    WaterfallImage waterfall;
+    double frequencyMax = 0.0;
+    bool frequencyKnown = false;
+    double timeSpan = 0.0;
+};
+
+// Scrolling spectrogram of one signal: every spectrum, or the mean of the spectra of one
+// row period, becomes a row of colours at the top of a circular image. Transforms and
+// colour mapping run on the acquisition thread; the GUI thread copies the new rows into
+// the image and blits it, so its cost per frame is bounded by the image size.
+class QtWaterfallFbImpl : public daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>
+{
+    using Super = daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>;
+
+public:
+    explicit QtWaterfallFbImpl(const daq::ContextPtr& ctx,
+                               const daq::ComponentPtr& parent,
+                               const daq::StringPtr& localId,
+                               const daq::PropertyObjectPtr& config = nullptr);
+
+    ~QtWaterfallFbImpl() override;
+
+    static daq::FunctionBlockTypePtr CreateType();
+
+    void onConnected(const daq::InputPortPtr& inputPort) override;
+    void onDisconnected(const daq::InputPortPtr& inputPort) override;
+    void onPacketReceived(const daq::InputPortPtr& port) override;
+
+    // Implement IQTWidget interface
+    ErrCode getWidget(struct QWidget** widget) override;
+
+private:
+    void initProperties();
+    void propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value);
+    void createInputPort();
+
+    // Acquisition thread
+    void acquire();
+    void addSpectrum(const std::vector<double>& power);  // Fold into the current row, emit it once complete
+    void emitRow();
+
+    // GUI thread
+    void createWidget();
+    void updatePlot();
+
+private:
+    std::unique_ptr<SpectrumSignal> source;  // The one input signal
+
+    // Properties
+    size_t fftSize = 1024;
+    SpectrumWindow window = SpectrumWindow::Hann;
+    double overlap = 50.0;  // Percent
+    double duration = 10.0;  // Seconds from the top to the bottom of the image
+    ColorMap colorMap = ColorMap::Inferno;
+    double minDb = -120.0;   // Colour range; changes apply to rows drawn from then on
+    double maxDb = 0.0;
+
+    // Image geometry, published by the GUI thread
+    std::atomic<int> imageWidth{0};
+    std::atomic<int> imageRows{0};
+
+    // Row being built (config lock)
+    ColorTable colorTable = makeColorTable(colorMap);
+    std::vector<double> rowPower;  // Sum of the spectra of the row
+    int rowSpectra = 0;
+    int spectraPerRow = 1;
+    std::vector<QRgb> rowPixels;
+    int rowWidth = 0;  // Image width the row is built for
+    int rowsEmitted = 0;  // Rows queued by the current acquire
+
+    // Frequency scale of the rows, for the GUI
+    std::atomic<double> frequencyMax{0.0};
+    std::atomic<bool> frequencyKnown{false};
+    std::atomic<double> timeSpan{0.0};
+
+    // Qt Widget
+    QPointer<QWidget> embeddedWidget;
+    QPointer<WaterfallWidget> waterfallWidget;
+    WaterfallRowQueue rowQueue;
+    LiveView liveView;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,138 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/batch_reader.h>
+#include <opendaq_qt_module/density_raster.h>
+#include <opendaq_qt_module/live_view.h>
+#include <opendaq_qt_module/triple_buffer.h>
+#include <opendaq_qt_module/waterfall_image.h>
+#include <qt_widget_interface/qt_widget_interface.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/function_block_type_factory.h>
+#include <QPointer>
+#include <QRgb>
+#include <QWidget>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Rendered density raster of an XY view, published by the acquisition thread
+struct XyFrame
+{
+    std::vector<QRgb> pixels;  // width * height, top row first
+    int width = 0;
+    int height = 0;
+    double xMin = 0.0;
+    double xMax = 0.0;
+    double yMin = 0.0;
+    double yMax = 0.0;
+    std::string xCaption;
+    std::string yCaption;
+};
+
+// Draws the published XyFrame with its value ranges around it
+class XyWidget : public QWidget
+{
+public:
+    // `onResize` gets the raster size in pixels whenever the plot area changes
+    explicit XyWidget(std::function<void(int width, int height)> onResize, QWidget* parent = nullptr);
+
+    void detach();  // Function block is going away
+    void setFrame(const XyFrame* newFrame);  // Kept until the next call; nullptr for none
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+
+private:
+    QRect plotRect() const;
+
+    std::function<void(int, int)> resized;
+    const XyFrame* frame = nullptr;
+};
+
+// One signal against another: samples of the X and Y ports are paired on their common
+// domain by one aligned MultiReader and accumulated into a persistence raster on the
+// acquisition thread, so any number of points costs one raster to draw.
+class QtXyFbImpl : public daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>
+{
+    using Super = daq::FunctionBlockImpl<daq::IFunctionBlock, IQTWidget>;
+
+public:
+    explicit QtXyFbImpl(const daq::ContextPtr& ctx,
+                        const daq::ComponentPtr& parent,
+                        const daq::StringPtr& localId,
+                        const daq::PropertyObjectPtr& config = nullptr);
+
+    ~QtXyFbImpl() override;
+
+    static daq::FunctionBlockTypePtr CreateType();
+
+    void onConnected(const daq::InputPortPtr& inputPort) override;
+    void onDisconnected(const daq::InputPortPtr& inputPort) override;
+    void onPacketReceived(const daq::InputPortPtr& port) override;
+
+    // Implement IQTWidget interface
+    ErrCode getWidget(struct QWidget** widget) override;
+
+private:
+    void initProperties();
+    void propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value);
+
+    // Acquisition thread
+    void acquire();
+    bool openReader();
+    size_t readPairs();  // Returns the number of pairs accumulated
+    void handleEvents();
+    void fitRange(const double* x, const double* y, size_t count);
+    void applyDecay();
+
+    // GUI thread
+    void createWidget();
+    void updatePlot();
+
+private:
+    daq::InputPortPtr xPort;
+    daq::InputPortPtr yPort;
+    std::unique_ptr<BatchReader> pairReader;  // X and Y, aligned; while both are connected
+    bool readerFailed = false;                // Not retried until the connections change
+    std::string xCaption;
+    std::string yCaption;
+
+    // Properties
+    bool autoRange = true;  // Grow the range to the data; a grown range starts the raster over
+    double xMin = -1.0;
+    double xMax = 1.0;
+    double yMin = -1.0;
+    double yMax = 1.0;
+    double persistence = 1.0;  // Seconds for hits to fade to half, 0 to keep them
+    ColorMap colorMap = ColorMap::Inferno;
+
+    // Raster (config lock)
+    DensityRaster raster;
+    ColorTable colorTable = makeColorTable(colorMap);
+    std::chrono::steady_clock::time_point lastDecay;
+
+    // Raster geometry, published by the GUI thread
+    std::atomic<int> rasterWidth{0};
+    std::atomic<int> rasterHeight{0};
+    std::atomic<bool> clearRequested{false};
+
+    // Qt Widget
+    QPointer<QWidget> embeddedWidget;
+    QPointer<XyWidget> xyWidget;
+
+    LiveView liveView;
+    TripleBuffer<XyFrame> frameBuffer;  // Acquisition -> GUI
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
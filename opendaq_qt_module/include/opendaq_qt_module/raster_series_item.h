@@ -0,0 +1,71 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QGraphicsObject>
+#include <QImage>
+#include <QPen>
+#include <QPointer>
+#include <QPointF>
+#include <QPolygonF>
+#include <QVector>
+#include <QtGlobal>
+#include <map>
+
+QT_BEGIN_NAMESPACE
+class QChart;
+class QDateTimeAxis;
+class QValueAxis;
+QT_END_NAMESPACE
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Lightweight alternative to QLineSeries for drawing many points.
+// Draws every signal's polyline straight into a raster cached over the chart's
+// plot area, mapped through the chart's own axes. The QLineSeries of each signal
+// stays in the chart without points so legend, axes and markers keep working;
+// its pen and visibility are used for drawing.
+// Where several points fall into one pixel column only the column's entry, min,
+// max and exit values are drawn, which is what a polyline through all of them
+// would cover anyway.
+class RasterSeriesItem : public QGraphicsObject
+{
+public:
+    RasterSeriesItem(QChart* chart, QDateTimeAxis* axisX, QValueAxis* axisY);
+
+    // Replace the points of a signal; `points` are (ms since epoch, value) like QLineSeries
+    void setSignal(quint64 signalId, const QVector<QPointF>& points, const QPen& pen, bool visible);
+    void removeSignal(quint64 signalId);
+    void clearSignals();
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+private:
+    struct Layer
+    {
+        QVector<QPointF> points;
+        QPen pen;
+        bool visible = true;
+    };
+
+    void invalidate();
+    void render(qreal devicePixelRatio);
+
+    QPointer<QChart> chart;
+    QPointer<QDateTimeAxis> axisX;
+    QPointer<QValueAxis> axisY;
+
+    std::map<quint64, Layer> layers;  // Drawn in signal id (creation) order
+
+    QImage cache;
+    bool cacheValid = false;
+    QRectF plotArea;
+
+    QPolygonF polyline;  // Reused between layers and frames
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
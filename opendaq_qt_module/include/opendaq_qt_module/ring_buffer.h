@@ -0,0 +1,99 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Growable circular queue with O(1) push_back/pop_front and random access.
+// Storage is a power-of-two vector that only grows unless shrunk explicitly,
+// so a ring that has reached its steady-state size no longer allocates.
+template <typename T>
+class RingBuffer
+{
+public:
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return items.size(); }
+
+    void clear()
+    {
+        head = 0;
+        count = 0;
+    }
+
+    void reserve(size_t newCapacity)
+    {
+        if (newCapacity <= capacity())
+            return;
+        reallocate(roundUp(newCapacity));
+    }
+
+    // Release storage beyond what the current items need
+    void shrink_to_fit()
+    {
+        const size_t rounded = roundUp(count);
+        if (rounded < capacity())
+            reallocate(rounded);
+    }
+
+    void push_back(const T& item)
+    {
+        if (count == capacity())
+            reserve(std::max<size_t>(capacity() * 2, 16));
+        items[(head + count) & mask] = item;
+        ++count;
+    }
+
+    void pop_front(size_t n = 1)
+    {
+        n = std::min(n, count);
+        head = (head + n) & mask;
+        count -= n;
+    }
+
+    void pop_back()
+    {
+        if (count > 0)
+            --count;
+    }
+
+    T& operator[](size_t i) { return items[(head + i) & mask]; }
+    const T& operator[](size_t i) const { return items[(head + i) & mask]; }
+
+    const T& front() const { return (*this)[0]; }
+    const T& back() const { return (*this)[count - 1]; }
+
+private:
+    static size_t roundUp(size_t wanted)
+    {
+        size_t rounded = 16;
+        while (rounded < wanted)
+            rounded <<= 1;
+        return rounded;
+    }
+
+    void reallocate(size_t rounded)
+    {
+        std::vector<T> newItems(rounded);
+        for (size_t i = 0; i < count; ++i)
+            newItems[i] = (*this)[i];
+
+        items.swap(newItems);
+        head = 0;
+        mask = rounded - 1;
+    }
+
+    std::vector<T> items;
+    size_t head = 0;
+    size_t count = 0;
+    size_t mask = 0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,137 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/simd_kernels.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Compensated (Kahan-Babuska-Neumaier) sum: its error does not grow with the number of terms
+struct KahanSum
+{
+    double sum = 0.0;
+    double compensation = 0.0;
+
+    void add(double value);
+    void add(const KahanSum& other);
+    double value() const { return sum + compensation; }
+};
+
+// Moments of a set of samples, merged with the parallel form of Welford's algorithm, so
+// blocks summed in SIMD lanes combine without the cancellation of sum-of-squares formulas
+struct Moments
+{
+    uint64_t count = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;        // Sum of squared deviations from the mean
+    KahanSum sumSquares;    // For the RMS
+
+    void add(const Kernels::BlockMoments& block);
+    void merge(const Moments& other);
+};
+
+struct StatisticsSnapshot
+{
+    uint64_t count = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    double stdDev = 0.0;      // Sample standard deviation
+    double rms = 0.0;
+    double sampleRate = 0.0;  // Received samples per second of domain time, 0 if unknown
+    uint64_t dropped = 0;     // Samples missing from a linear domain
+};
+
+struct StatisticsSettings
+{
+    double window = 1.0;  // Sliding window in seconds
+    int bins = 64;
+    bool autoRange = true;  // Histogram range follows the data; a grown range restarts the histograms
+    double histogramMin = -1.0;
+    double histogramMax = 1.0;
+
+    bool operator==(const StatisticsSettings& other) const
+    {
+        return window == other.window && bins == other.bins && autoRange == other.autoRange &&
+               histogramMin == other.histogramMin && histogramMax == other.histogramMax;
+    }
+    bool operator!=(const StatisticsSettings& other) const { return !(*this == other); }
+};
+
+// Cumulative and sliding-window statistics and histograms of a sample stream. The
+// sliding window is kept as a queue of chunks of a sixteenth of the window each, so
+// samples never have to be subtracted again: the window is merged from its chunks, and
+// moves in steps of one chunk.
+class RunningStatistics
+{
+public:
+    void configure(const StatisticsSettings& newSettings);  // Changed settings restart the statistics
+
+    // Domain of the ticks passed to add(); 0 if unknown. Restarts the statistics.
+    void setDomain(double secondsPerTick, int64_t linearDelta);
+
+    void reset();
+
+    // Samples with their domain ticks
+    void add(const double* values, const int64_t* ticks, size_t count);
+
+    int64_t latestTick() const { return lastTick; }  // Of the last sample added
+    StatisticsSnapshot cumulative() const;
+    StatisticsSnapshot sliding() const;
+
+    // Counts per bin over [histogramMin(), histogramMax()), false while there is no range yet
+    bool histogram(bool slidingWindow, std::vector<uint64_t>& counts) const;
+    double histogramMin() const { return rangeMin; }
+    double histogramMax() const { return rangeMax; }
+
+private:
+    struct Chunk
+    {
+        bool started = false;
+        Moments moments;
+        int64_t firstTick = 0;
+        int64_t lastTick = 0;
+        uint64_t dropped = 0;
+        std::vector<uint64_t> histogram;
+    };
+
+    void addPiece(const double* values, const int64_t* ticks, size_t count);
+    void countDropped(const int64_t* ticks, size_t count);
+    void fitRange(double low, double high);
+    void clearHistograms();
+    void closeChunk();
+    void updateWindow();
+    StatisticsSnapshot snapshot(const Moments& moments, int64_t first, int64_t last, uint64_t dropped) const;
+
+    StatisticsSettings settings;
+    double tickSeconds = 0.0;
+    int64_t tickDelta = 0;
+    int64_t windowTicks = 0;  // 0: no tick resolution, the window cannot be measured and covers everything
+    int64_t chunkTicks = 0;
+
+    Moments total;
+    int64_t firstTick = 0;
+    int64_t lastTick = 0;
+    bool hasTicks = false;
+    uint64_t totalDropped = 0;
+    std::vector<uint64_t> totalHistogram;
+
+    Chunk current;
+    std::deque<Chunk> chunks;  // Closed chunks of the window, oldest first
+    std::vector<uint64_t> spareHistogram;  // Of the last chunk that left the window, for the next one
+
+    double rangeMin = 0.0;
+    double rangeMax = 0.0;
+    double binScale = 0.0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,632 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/minmax_pyramid.h>
+#include <opendaq_qt_module/prefix_sums.h>
+#include <QPointF>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Maps raw domain ticks to milliseconds since the Unix epoch:
+// ms = originMs + ticks * msPerTick
+struct DomainMapping
+{
+    double originMs = 0.0;
+    double msPerTick = 1.0;
+
+    bool operator==(const DomainMapping& other) const
+    {
+        return originMs == other.originMs && msPerTick == other.msPerTick;
+    }
+};
+
+// Circular history store of (domain tick, value) samples for one plotted signal,
+// kept in the signal's native value sample type.
+// Samples are kept in time order; index 0 is always the oldest sample.
+// Append and evict are O(1) (eviction only moves the head), lookups by time
+// are binary searches over the logical (unwrapped) index range.
+// Every sample also has an absolute index (count of samples ever appended)
+// that the min/max pyramid and the prefix sums kept alongside the samples are keyed on.
+// Ticks are stored as 32-bit offsets from a per-signal epoch tick (the first
+// sample's tick) and widened to milliseconds only when a time is asked for, so
+// times keep the domain's full resolution. When the offsets would overflow, the
+// epoch moves up to the oldest stored sample. Fine tick resolutions (ns ticks span
+// 2^32 in 4.3 s) get 64-bit offsets: a second array holds their upper halves, chosen
+// up front from the history duration and tick resolution, or on demand once the
+// stored span outgrows 32 bits.
+template <typename ValueT, typename DomainT>
+class SignalHistory
+{
+public:
+    using ValueType = ValueT;
+    using DomainType = DomainT;
+
+    SignalHistory() = default;
+
+    void setDomainMapping(const DomainMapping& newMapping)
+    {
+        if (mapping == newMapping)
+            return;
+
+        // Ticks already stored are meaningless under a different mapping
+        clear();
+        mapping = newMapping;
+        setEpoch(epochTick);
+        setWideOffsets(needsWideOffsets());
+    }
+
+    const DomainMapping& domainMapping() const { return mapping; }
+
+    // Size the store for `durationSec` seconds of data at `sampleRate` Hz.
+    // Keeps the newest samples if the store has to shrink.
+    void reserveFor(double durationSec, double sampleRate)
+    {
+        setCapacity(capacityFor(durationSec, sampleRate));
+
+        // Offsets only narrow again while nothing is stored
+        spanSec = durationSec;
+        if (needsWideOffsets() || isEmpty())
+            setWideOffsets(needsWideOffsets());
+    }
+
+    static size_t capacityFor(double durationSec, double sampleRate)
+    {
+        if (durationSec <= 0.0 || sampleRate <= 0.0)
+            return MinCapacity;
+
+        // Headroom for one read block on top of the history window
+        const double samplesNeeded = durationSec * sampleRate * 1.25 + sampleRate * 0.5;
+        if (samplesNeeded < static_cast<double>(MaxCapacity))
+            return static_cast<size_t>(std::ceil(samplesNeeded));
+        return MaxCapacity;
+    }
+
+    void setCapacity(size_t newCapacity)
+    {
+        newCapacity = roundUpPow2(std::min(std::max(newCapacity, MinCapacity), MaxCapacity));
+        if (newCapacity == capacity())
+            return;
+
+        const size_t keep = std::min(count, newCapacity);
+        const size_t skip = count - keep;
+
+        const bool shrinking = newCapacity < capacity();
+        std::vector<TickOffset> newTicks(newCapacity);
+        std::vector<TickOffset> newTickHighs(wideOffsets ? newCapacity : 0);
+        std::vector<ValueT> newValues(newCapacity);
+        for (size_t i = 0; i < keep; ++i)
+        {
+            const size_t src = physical(skip + i);
+            newTicks[i] = ticks[src];
+            newValues[i] = values[src];
+        }
+        for (size_t i = 0; wideOffsets && i < keep; ++i)
+            newTickHighs[i] = tickHighs[physical(skip + i)];
+
+        ticks.swap(newTicks);
+        tickHighs.swap(newTickHighs);
+        values.swap(newValues);
+        head = 0;
+        count = keep;
+        mask = newCapacity - 1;
+        firstIndex += static_cast<qint64>(skip);
+        pyramid.evictBefore(firstIndex);
+        sums.evictBefore(firstIndex);
+        if (shrinking)
+        {
+            pyramid.shrinkToFit();
+            sums.shrinkToFit();
+        }
+    }
+
+    size_t capacity() const { return ticks.size(); }
+
+    // Heap held by the samples and their indexes
+    size_t memoryBytes() const { return bytesFor(capacity()) + pyramid.memoryBytes() + sums.memoryBytes(); }
+
+    // Heap of the samples alone at `capacity`, rounded as setCapacity rounds it
+    size_t bytesFor(size_t capacity) const
+    {
+        const size_t tickBytes = wideOffsets ? 2 * sizeof(TickOffset) : sizeof(TickOffset);
+        return roundUpPow2(std::max(capacity, MinCapacity)) * (tickBytes + sizeof(ValueT));
+    }
+
+    bool hasWideOffsets() const { return wideOffsets; }
+    int size() const { return static_cast<int>(count); }
+    bool isEmpty() const { return count == 0; }
+
+    void clear()
+    {
+        firstIndex += static_cast<qint64>(count);
+        head = 0;
+        count = 0;
+        pyramid.clear(firstIndex);
+        sums.clear(firstIndex);
+        setWideOffsets(needsWideOffsets());
+    }
+
+    // Append a sample; grows (amortised O(1)) only if the reserved capacity is exceeded,
+    // and drops the oldest sample once the ring is full at MaxCapacity
+    void append(DomainT tick, ValueT value)
+    {
+        if (count == capacity())
+        {
+            if (capacity() < MaxCapacity)
+                setCapacity(capacity() * 2);
+            else
+                dropOldest(1);
+        }
+
+        if (count == 0)
+            setEpoch(tick);
+        else if (tick < epochTick || static_cast<DomainT>(tick - epochTick) > maxTickOffset())
+            rebase(tick);
+
+        const size_t idx = physical(count);
+        setOffset(idx, static_cast<uint64_t>(tick - epochTick));
+        values[idx] = value;
+        pyramid.append(firstIndex + static_cast<qint64>(count), value);
+        sums.append(firstIndex + static_cast<qint64>(count), value);
+        ++count;
+    }
+
+    void append(const DomainT* newTicks, const ValueT* newValues, size_t n)
+    {
+        const size_t skip = n > MaxCapacity ? n - MaxCapacity : 0;
+        makeRoom(n - skip);
+
+        for (size_t i = skip; i < n; ++i)
+            append(newTicks[i], newValues[i]);
+    }
+
+    // Append samples of a linear-rule domain at firstTick, firstTick + delta, ...;
+    // tick offsets are generated in bulk instead of being converted one by one
+    void appendLinear(DomainT firstTick, DomainT delta, const ValueT* newValues, size_t n)
+    {
+        if (n == 0)
+            return;
+        if (n > MaxCapacity)
+        {
+            // Only the newest MaxCapacity samples of an oversized block can be kept
+            const size_t skip = n - MaxCapacity;
+            firstTick += static_cast<DomainT>(skip) * delta;
+            newValues += skip;
+            n = MaxCapacity;
+        }
+        makeRoom(n);
+
+        // The first sample sets or moves the epoch; the rest of the block must fit its offsets
+        append(firstTick, newValues[0]);
+        const DomainT lastTick = firstTick + static_cast<DomainT>(n - 1) * delta;
+        if (static_cast<DomainT>(lastTick - epochTick) > maxTickOffset())
+        {
+            for (size_t i = 1; i < n; ++i)
+                append(firstTick + static_cast<DomainT>(i) * delta, newValues[i]);
+            return;
+        }
+
+        const uint64_t firstOffset = static_cast<uint64_t>(firstTick - epochTick);
+        const uint64_t step = static_cast<uint64_t>(delta);
+        size_t i = 1;
+        while (i < n)
+        {
+            // Contiguous run up to the physical end of the ring
+            const size_t start = physical(count);
+            const size_t run = std::min(n - i, capacity() - start);
+            TickOffset* tickOut = ticks.data() + start;
+            ValueT* valueOut = values.data() + start;
+            for (size_t j = 0; j < run; ++j)
+            {
+                tickOut[j] = static_cast<TickOffset>(firstOffset + static_cast<uint64_t>(i + j) * step);
+                valueOut[j] = newValues[i + j];
+            }
+            if (wideOffsets)
+            {
+                TickOffset* highOut = tickHighs.data() + start;
+                for (size_t j = 0; j < run; ++j)
+                    highOut[j] = static_cast<TickOffset>((firstOffset + static_cast<uint64_t>(i + j) * step) >> 32);
+            }
+            for (size_t j = 0; j < run; ++j)
+                pyramid.append(firstIndex + static_cast<qint64>(count + j), newValues[i + j]);
+            for (size_t j = 0; j < run; ++j)
+                sums.append(firstIndex + static_cast<qint64>(count + j), newValues[i + j]);
+
+            count += run;
+            i += run;
+        }
+    }
+
+    // Drop all samples older than `minTimeToKeep` (ms)
+    void evictBefore(double minTimeToKeep)
+    {
+        const int firstValidIdx = binarySearchFirstGE(minTimeToKeep);
+        if (firstValidIdx > 0)
+            dropOldest(static_cast<size_t>(firstValidIdx));
+    }
+
+    // Widen a raw tick to milliseconds; ticks are taken relative to the epoch
+    // tick so large absolute tick counts keep sub-millisecond precision
+    double toMsec(DomainT tick) const
+    {
+        const qint64 relative = static_cast<qint64>(tick - epochTick);
+        return epochMsec + static_cast<double>(relative) * mapping.msPerTick;
+    }
+
+    DomainT tickAt(int i) const { return epochTick + static_cast<DomainT>(offsetAt(physical(static_cast<size_t>(i)))); }
+    double timeAt(int i) const
+    {
+        return epochMsec + static_cast<double>(offsetAt(physical(static_cast<size_t>(i)))) * mapping.msPerTick;
+    }
+    ValueT valueAt(int i) const { return values[physical(static_cast<size_t>(i))]; }
+    QPointF pointAt(int i) const { return QPointF(timeAt(i), static_cast<double>(valueAt(i))); }
+
+    // Values lie in the ring itself, so a logical range is at most two contiguous runs
+    static constexpr bool HasValueRuns = true;
+
+    // Run of the ring from logical index `first` up to at most `last`; returns its length
+    int valueRun(int first, int last, const ValueT*& run) const
+    {
+        const size_t start = physical(static_cast<size_t>(first));
+        run = values.data() + start;
+        return static_cast<int>(std::min(static_cast<size_t>(last - first + 1), capacity() - start));
+    }
+
+    // Values and times of [first, last] widened to double, run by run instead of index by index
+    void valuesInto(int first, int last, double* out) const
+    {
+        for (int pos = first; pos <= last;)
+        {
+            const ValueT* run = nullptr;
+            const int runCount = valueRun(pos, last, run);
+            for (int j = 0; j < runCount; ++j)
+                out[j] = static_cast<double>(run[j]);
+            out += runCount;
+            pos += runCount;
+        }
+    }
+
+    void timesInto(int first, int last, double* out) const
+    {
+        for (int pos = first; pos <= last;)
+        {
+            const size_t start = physical(static_cast<size_t>(pos));
+            const int runCount = static_cast<int>(std::min(static_cast<size_t>(last - pos + 1), capacity() - start));
+            const TickOffset* low = ticks.data() + start;
+            if (wideOffsets)
+            {
+                const TickOffset* high = tickHighs.data() + start;
+                for (int j = 0; j < runCount; ++j)
+                    out[j] = epochMsec + static_cast<double>((static_cast<uint64_t>(high[j]) << 32) | low[j]) * mapping.msPerTick;
+            }
+            else
+            {
+                for (int j = 0; j < runCount; ++j)
+                    out[j] = epochMsec + static_cast<double>(static_cast<uint64_t>(low[j])) * mapping.msPerTick;
+            }
+            out += runCount;
+            pos += runCount;
+        }
+    }
+
+    // Absolute index <-> logical index
+    qint64 absoluteIndex(int i) const { return firstIndex + i; }
+    int logicalIndex(qint64 absIndex) const { return static_cast<int>(absIndex - firstIndex); }
+
+    const MinMaxPyramid<ValueT>& minMaxPyramid() const { return pyramid; }
+
+    double firstTime() const { return timeAt(0); }
+    double lastTime() const { return timeAt(size() - 1); }
+
+    // First index with time >= targetTime, size() if none
+    int binarySearchFirstGE(double targetTime) const
+    {
+        int left = 0;
+        int right = size() - 1;
+        int result = size();
+
+        while (left <= right)
+        {
+            int mid = left + (right - left) / 2;
+            if (timeAt(mid) >= targetTime)
+            {
+                result = mid;
+                right = mid - 1;
+            }
+            else
+            {
+                left = mid + 1;
+            }
+        }
+
+        return result;
+    }
+
+    // Last index with time <= targetTime, startIdx - 1 if none
+    // All points before startIdx are known to be < targetTime
+    int binarySearchLastLE(double targetTime, int startIdx = 0) const
+    {
+        int left = startIdx;
+        int right = size() - 1;
+        int result = startIdx - 1;
+
+        while (left <= right)
+        {
+            int mid = left + (right - left) / 2;
+            if (timeAt(mid) <= targetTime)
+            {
+                result = mid;
+                left = mid + 1;
+            }
+            else
+            {
+                right = mid - 1;
+            }
+        }
+
+        return result;
+    }
+
+    // Index range covering [visibleMin, visibleMax] plus one neighbour on each side,
+    // (-1, -1) if nothing is visible
+    std::pair<int, int> visibleRange(double visibleMin, double visibleMax) const
+    {
+        if (isEmpty())
+            return std::make_pair(-1, -1);
+
+        int startIdx = binarySearchFirstGE(visibleMin);
+        int lastIdx = binarySearchLastLE(visibleMax, startIdx);
+
+        // Include nearest invisible point on the left side (if exists) to not lose left boundary point
+        if (startIdx > 0 && startIdx < size())
+            startIdx--;
+
+        // Include nearest invisible point on the right side (if exists) to not lose right boundary point
+        if (lastIdx >= 0 && lastIdx + 1 < size())
+            lastIdx++;
+
+        // Check if we found valid range
+        if (startIdx > lastIdx || startIdx >= size() || lastIdx < 0)
+            return std::make_pair(-1, -1);
+
+        // Ensure indices are within bounds
+        if (startIdx < 0)
+            startIdx = 0;
+        if (lastIdx >= size())
+            lastIdx = size() - 1;
+
+        return std::make_pair(startIdx, lastIdx);
+    }
+
+    // Linearly interpolated value at `timeMsec`, NaN if empty
+    double valueAtTime(double timeMsec) const
+    {
+        if (isEmpty())
+            return std::numeric_limits<double>::quiet_NaN();
+
+        const int n = size();
+
+        // Handle edge cases
+        if (timeMsec <= firstTime())
+            return static_cast<double>(valueAt(0));
+        if (timeMsec >= lastTime())
+            return static_cast<double>(valueAt(n - 1));
+
+        // Find the interval containing timeMsec
+        const int right = binarySearchFirstGE(timeMsec);
+        if (right <= 0 || right >= n)
+            return static_cast<double>(valueAt(right >= n ? n - 1 : 0));
+
+        const int left = right - 1;
+        const double t1 = timeAt(left);
+        const double t2 = timeAt(right);
+        const double v1 = static_cast<double>(valueAt(left));
+        const double v2 = static_cast<double>(valueAt(right));
+
+        if (t2 == t1)
+            return v1;
+
+        const double ratio = (timeMsec - t1) / (t2 - t1);
+        return v1 + ratio * (v2 - v1);
+    }
+
+    // Statistics of the samples in [fromMsec, toMsec]: extremes from the pyramid, sums from
+    // the prefix sums, raw samples only at the edges; O(log n) however many samples it covers
+    RangeStatistics statistics(double fromMsec, double toMsec) const
+    {
+        RangeStatistics result;
+        if (isEmpty() || toMsec < fromMsec)
+            return result;
+
+        const int beginIdx = binarySearchFirstGE(fromMsec);
+        const int endIdx = binarySearchLastLE(toMsec, beginIdx);
+        if (beginIdx > endIdx)
+            return result;
+
+        const qint64 first = absoluteIndex(beginIdx);
+        const qint64 last = absoluteIndex(endIdx);
+        result.count = last - first + 1;
+
+        // Values are compared natively, so 64-bit integers keep their order
+        ValueT minValue = valueAt(beginIdx);
+        ValueT maxValue = minValue;
+        auto rawExtremes = [&](qint64 rawFirst, qint64 rawLast)
+        {
+            const int lastIdx = logicalIndex(rawLast);
+            for (int i = logicalIndex(rawFirst); i <= lastIdx; ++i)
+            {
+                const ValueT value = valueAt(i);
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+            }
+        };
+        int level = MinMaxPyramid<ValueT>::MinLevel;
+        while (level < MinMaxPyramid<ValueT>::MaxLevel && (qint64(2) << level) <= result.count)
+            ++level;
+        pyramid.visit(level, first, last, rawExtremes, [&](const auto& bucket)
+        {
+            minValue = std::min(minValue, bucket.minValue);
+            maxValue = std::max(maxValue, bucket.maxValue);
+        });
+        result.min = static_cast<double>(minValue);
+        result.max = static_cast<double>(maxValue);
+
+        qint64 blockFirst = 0;
+        qint64 blockLast = 0;
+        const auto blockSums = sums.blocks(first, last, blockFirst, blockLast);
+        result.sum = blockSums.sum;
+        result.sumSquares = blockSums.sumSquares;
+        auto addRaw = [&](qint64 rawFirst, qint64 rawLast)
+        {
+            const int lastIdx = logicalIndex(rawLast);
+            for (int i = logicalIndex(rawFirst); i <= lastIdx; ++i)
+            {
+                const double x = static_cast<double>(valueAt(i));
+                result.sum += x;
+                result.sumSquares += x * x;
+            }
+        };
+        if (blockFirst > blockLast)
+        {
+            addRaw(first, last);
+        }
+        else
+        {
+            addRaw(first, blockFirst - 1);
+            addRaw(blockLast + 1, last);
+        }
+        return result;
+    }
+
+private:
+    using TickOffset = uint32_t;
+
+    static constexpr size_t MinCapacity = 256;
+    static constexpr size_t MaxCapacity = size_t(1) << 30;
+    static constexpr DomainT MaxNarrowOffset = std::numeric_limits<TickOffset>::max();
+
+    DomainT maxTickOffset() const { return wideOffsets ? std::numeric_limits<DomainT>::max() : MaxNarrowOffset; }
+
+    uint64_t offsetAt(size_t idx) const
+    {
+        if (!wideOffsets)
+            return ticks[idx];
+        return (static_cast<uint64_t>(tickHighs[idx]) << 32) | ticks[idx];
+    }
+
+    void setOffset(size_t idx, uint64_t offset)
+    {
+        ticks[idx] = static_cast<TickOffset>(offset);
+        if (wideOffsets)
+            tickHighs[idx] = static_cast<TickOffset>(offset >> 32);
+    }
+
+    // Whether the history window, with the headroom capacityFor adds, spans more ticks than 32 bits hold
+    bool needsWideOffsets() const
+    {
+        if (mapping.msPerTick <= 0.0)
+            return false;
+        const double spanTicks = (spanSec * 1.25 + 0.5) * 1000.0 / mapping.msPerTick;
+        return spanTicks > static_cast<double>(MaxNarrowOffset);
+    }
+
+    // Stored offsets fit 32 bits when widening, so their upper halves start at zero
+    void setWideOffsets(bool wide)
+    {
+        if (wide == wideOffsets)
+            return;
+
+        wideOffsets = wide;
+        if (wide)
+            tickHighs.assign(capacity(), 0);
+        else
+            std::vector<TickOffset>().swap(tickHighs);
+    }
+
+    void setEpoch(DomainT tick)
+    {
+        epochTick = tick;
+        epochMsec = mapping.originMs + static_cast<double>(epochTick) * mapping.msPerTick;
+    }
+
+    // Move the epoch so that `tick` fits an offset; rarely needed (every 2^32 ticks)
+    void rebase(DomainT tick)
+    {
+        const DomainT oldest = tickAt(0);
+        if (tick < oldest)
+        {
+            // Time went back past the oldest sample
+            clear();
+            setEpoch(tick);
+            return;
+        }
+        if (static_cast<DomainT>(tick - oldest) > maxTickOffset())
+        {
+            // The stored span outgrew 32-bit offsets; all of them still fit from the current epoch
+            setWideOffsets(true);
+            return;
+        }
+
+        const TickOffset shift = static_cast<TickOffset>(oldest - epochTick);
+        for (size_t i = 0; i < count; ++i)
+            ticks[physical(i)] -= shift;
+        setEpoch(oldest);
+    }
+
+    static size_t roundUpPow2(size_t value)
+    {
+        size_t result = 1;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    size_t physical(size_t logicalIdx) const { return (head + logicalIdx) & mask; }
+
+    void dropOldest(size_t n)
+    {
+        n = std::min(n, count);
+        head = physical(n);
+        count -= n;
+        firstIndex += static_cast<qint64>(n);
+        pyramid.evictBefore(firstIndex);
+        sums.evictBefore(firstIndex);
+    }
+
+    // Grow for `n` more samples (n <= MaxCapacity); past MaxCapacity the oldest make way
+    void makeRoom(size_t n)
+    {
+        if (count + n > capacity())
+            setCapacity(count + n);
+        if (count + n > capacity())
+            dropOldest(count + n - capacity());
+    }
+
+    std::vector<TickOffset> ticks;
+    std::vector<TickOffset> tickHighs;  // Upper halves of 64-bit offsets, empty while offsets are 32-bit
+    bool wideOffsets = false;
+    double spanSec = 0.0;  // Of the last reserveFor
+    std::vector<ValueT> values;
+    size_t head = 0;
+    size_t count = 0;
+    size_t mask = 0;
+    qint64 firstIndex = 0;  // Absolute index of logical index 0
+    DomainT epochTick = 0;
+    double epochMsec = 0.0;  // Time of epochTick
+    DomainMapping mapping;
+    MinMaxPyramid<ValueT> pyramid;
+    PrefixSums<ValueT> sums;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,317 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/downsampling.h>
+#include <opendaq_qt_module/follow_envelope.h>
+#include <opendaq_qt_module/signal_history.h>
+#include <opendaq_qt_module/spill_store.h>
+#include <opendaq_qt_module/storage_decimation.h>
+#include <opendaq_qt_module/trigger.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/sample_type.h>
+#include <QPointF>
+#include <QVector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Read path and history of one plotted signal, type-erased over the signal's
+// native value and domain sample types. The plotter talks to this interface
+// once per block or frame; everything per-sample runs in the typed implementation.
+class ISignalPath
+{
+public:
+    virtual ~ISignalPath() = default;
+
+    virtual daq::SampleType valueType() const = 0;
+    virtual daq::SampleType domainType() const = 0;
+
+    // Read up to `count` samples from `reader` into the path's read buffers, returns the number
+    // of samples read. History is not touched, so queries may run meanwhile; storeRead() stores them.
+    virtual size_t read(const daq::StreamReaderPtr& reader, size_t count, daq::ReaderStatusPtr& status) = 0;
+    virtual void storeRead() = 0;
+
+    // Domain follows a linear rule with `delta` ticks per sample (0: not linear). Only the first
+    // tick of each read is read then; the reader stops at gap and descriptor events, so the
+    // values after it follow the rule and history computes their ticks.
+    virtual void setLinearDomain(qint64 delta) = 0;
+
+    // Store every `binSize` samples as one min/max/first/last bin instead of the raw
+    // samples (0 or 1: store raw samples). Applies to samples read from now on.
+    virtual void setStorageDecimation(size_t binSize) = 0;
+    virtual size_t storageDecimation() const = 0;
+
+    virtual void setDomainMapping(const DomainMapping& mapping) = 0;
+    virtual void reserveFor(double durationSec, double sampleRate) = 0;
+    virtual void evictBefore(double minTimeMsec) = 0;  // Evicted samples go to the disk tier if enabled
+    virtual void clear() = 0;
+    virtual void setSpill(const SpillConfig& config) = 0;
+    virtual std::string takeSpillError() = 0;  // Empty if the disk tier had no failure
+
+    // Heap held by the memory tier, and what it will hold once pending shrinks are applied
+    virtual size_t memoryBytes() const = 0;
+    virtual size_t committedBytes() const = 0;
+
+    // Over memory and disk tiers
+    virtual bool isEmpty() const = 0;
+    virtual double firstTime() const = 0;
+    virtual double lastTime() const = 0;
+    virtual double valueAtTime(double timeMsec) const = 0;
+    virtual RangeStatistics statistics(double fromMsec, double toMsec) const = 0;  // Memory tier only
+    virtual double findTrigger(double afterMsec, double level, TriggerEdge edge) const = 0;  // First trigger after afterMsec, NaN if none; memory tier only
+    virtual void visiblePoints(const VisibleRequest& request, QVector<QPointF>& points) const = 0;  // Appends to `points`
+    virtual void releaseView(quint64 viewKey) = 0;  // Drop incremental state kept for request.viewKey
+};
+
+template <typename ValueT, typename DomainT>
+class NativeSignalPath : public ISignalPath
+{
+public:
+    NativeSignalPath(daq::SampleType valueSampleType, daq::SampleType domainSampleType)
+        : valueSampleType(valueSampleType)
+        , domainSampleType(domainSampleType)
+        , valueBuffer(200)
+        , domainBuffer(200)
+    {
+    }
+
+    daq::SampleType valueType() const override { return valueSampleType; }
+    daq::SampleType domainType() const override { return domainSampleType; }
+
+    size_t read(const daq::StreamReaderPtr& reader, size_t count, daq::ReaderStatusPtr& status) override
+    {
+        if (count > valueBuffer.size())
+        {
+            valueBuffer.resize(count);
+            domainBuffer.resize(count);
+        }
+
+        if (linearDelta == 0)
+        {
+            daq::SizeT readCount = count;
+            reader.readWithDomain(valueBuffer.data(), domainBuffer.data(), &readCount, 0, &status);
+            bufferedCount = readCount;
+            return bufferedCount;
+        }
+
+        // Linear domain: the first sample anchors the block, the rest are read as values only
+        daq::SizeT firstCount = std::min<size_t>(count, 1);
+        reader.readWithDomain(valueBuffer.data(), domainBuffer.data(), &firstCount, 0, &status);
+        if (firstCount == 0)
+            return 0;
+
+        daq::SizeT restCount = count - 1;
+        if (restCount > 0)
+            reader.read(valueBuffer.data() + 1, &restCount, 0, &status);
+        bufferedCount = restCount + 1;
+        return bufferedCount;
+    }
+
+    void storeRead() override
+    {
+        if (bufferedCount == 0)
+            return;
+
+        if (linearDelta == 0)
+            store(domainBuffer.data(), valueBuffer.data(), bufferedCount);
+        else
+            storeLinear(domainBuffer[0], linearDelta, valueBuffer.data(), bufferedCount);
+        bufferedCount = 0;
+    }
+
+    void setLinearDomain(qint64 delta) override { linearDelta = delta > 0 ? static_cast<DomainT>(delta) : DomainT(0); }
+
+    void setStorageDecimation(size_t binSize) override
+    {
+        if (binSize <= 1)
+            binSize = 0;
+        if (binSize == decimator.size())
+            return;
+
+        decimator.setSize(binSize, history);
+
+        // Samples already stored stay; a smaller ring is taken once they aged out
+        const size_t wanted = SignalHistory<ValueT, DomainT>::capacityFor(reservedDuration, storedRate());
+        if (wanted >= history.capacity() || static_cast<size_t>(history.size()) <= wanted)
+            history.setCapacity(wanted);
+        else
+            shrinkTo = wanted;
+    }
+    size_t storageDecimation() const override { return decimator.size(); }
+
+    void setDomainMapping(const DomainMapping& mapping) override
+    {
+        // Spilled times were mapped differently
+        if (!(history.domainMapping() == mapping))
+        {
+            spill.clear();
+            decimator.reset();
+        }
+        history.setDomainMapping(mapping);
+    }
+
+    void reserveFor(double durationSec, double sampleRate) override
+    {
+        reservedDuration = durationSec;
+        reservedRate = sampleRate;
+        shrinkTo = 0;
+        history.reserveFor(durationSec, storedRate());
+    }
+
+    void evictBefore(double minTimeMsec) override
+    {
+        if (spill.isEnabled())
+            spill.append(history, 0, history.binarySearchFirstGE(minTimeMsec));
+        history.evictBefore(minTimeMsec);
+
+        if (shrinkTo > 0 && static_cast<size_t>(history.size()) <= shrinkTo)
+        {
+            history.setCapacity(shrinkTo);
+            shrinkTo = 0;
+        }
+    }
+
+    void clear() override
+    {
+        history.clear();
+        spill.clear();
+        decimator.reset();
+    }
+
+    void setSpill(const SpillConfig& config) override { spill.setConfig(config); }
+    std::string takeSpillError() override { return spill.takeError(); }
+
+    size_t memoryBytes() const override { return history.memoryBytes(); }
+    size_t committedBytes() const override
+    {
+        if (shrinkTo == 0)
+            return history.memoryBytes();
+        return history.memoryBytes() - history.bytesFor(history.capacity()) + history.bytesFor(shrinkTo);
+    }
+
+    bool isEmpty() const override { return history.isEmpty() && spill.isEmpty(); }
+    double firstTime() const override { return spill.isEmpty() ? history.firstTime() : spill.firstTime(); }
+    double lastTime() const override { return history.isEmpty() ? spill.lastTime() : history.lastTime(); }
+
+    double valueAtTime(double timeMsec) const override
+    {
+        if (!spill.isEmpty() && (history.isEmpty() || timeMsec < history.firstTime()))
+        {
+            const double value = spill.valueAtTime(timeMsec);
+            if (!std::isnan(value) || history.isEmpty())
+                return value;
+        }
+        return history.valueAtTime(timeMsec);
+    }
+
+    RangeStatistics statistics(double fromMsec, double toMsec) const override { return history.statistics(fromMsec, toMsec); }
+
+    double findTrigger(double afterMsec, double level, TriggerEdge edge) const override
+    {
+        const int index = QtPlotter::findTrigger(history, history.binarySearchLastLE(afterMsec) + 1, level, edge);
+        return index < 0 ? std::numeric_limits<double>::quiet_NaN() : history.timeAt(index);
+    }
+
+    void visiblePoints(const VisibleRequest& request, QVector<QPointF>& points) const override
+    {
+        auto& followEnvelope = followEnvelopes[request.viewKey];
+        if (followEnvelope.accepts(history, request))
+        {
+            followEnvelope.update(history, request, points);
+            return;
+        }
+
+        const double memoryStart = history.isEmpty() ? std::numeric_limits<double>::infinity() : history.firstTime();
+        if (spill.isEmpty() || request.visibleMin >= memoryStart)
+        {
+            buildVisiblePoints(history, request, points);
+            return;
+        }
+
+        // Range reaches into the disk tier: share the point budget by time span
+        const double diskEnd = std::min(request.visibleMax, memoryStart);
+        const double span = request.visibleMax - request.visibleMin;
+        const double diskShare = span > 0.0 ? (diskEnd - request.visibleMin) / span : 1.0;
+        const size_t diskSamples = std::max<size_t>(static_cast<size_t>(request.maxSamples * diskShare), 2);
+
+        spill.visiblePoints(request.visibleMin, diskEnd, request.method, diskSamples, points);
+        if (request.visibleMax > memoryStart)
+        {
+            VisibleRequest memoryRequest = request;
+            memoryRequest.visibleMin = memoryStart;
+            memoryRequest.maxSamples = request.maxSamples > diskSamples ? request.maxSamples - diskSamples : 2;
+            buildVisiblePoints(history, memoryRequest, points);
+        }
+    }
+
+    void releaseView(quint64 viewKey) override { followEnvelopes.erase(viewKey); }
+
+private:
+    // Rate of samples entering the history: at most SamplesPerBin per bin when folding
+    double storedRate() const
+    {
+        if (!decimator.isActive())
+            return reservedRate;
+        return reservedRate * static_cast<double>(StorageDecimator<ValueT, DomainT>::SamplesPerBin) / static_cast<double>(decimator.size());
+    }
+
+    void store(const DomainT* ticks, const ValueT* values, size_t n)
+    {
+        if (!decimator.isActive())
+            history.append(ticks, values, n);
+        else
+            decimator.fold(history, values, n, [ticks](size_t i) { return ticks[i]; });
+    }
+
+    void storeLinear(DomainT firstTick, DomainT delta, const ValueT* values, size_t n)
+    {
+        if (!decimator.isActive())
+            history.appendLinear(firstTick, delta, values, n);
+        else
+            decimator.fold(history, values, n, [firstTick, delta](size_t i) { return firstTick + static_cast<DomainT>(i) * delta; });
+    }
+
+    daq::SampleType valueSampleType;
+    daq::SampleType domainSampleType;
+
+    SignalHistory<ValueT, DomainT> history;
+    SpillStore<ValueT> spill;  // Samples evicted from history, for scrollback beyond DurationHistory
+    StorageDecimator<ValueT, DomainT> decimator;
+    DomainT linearDelta = 0;
+
+    // Last reserveFor arguments, to resize the ring when the bin width changes
+    double reservedDuration = 0.0;
+    double reservedRate = 0.0;
+    size_t shrinkTo = 0;  // Pending smaller capacity, applied once history fits
+
+    // Derived from history, one per view; only touched by whoever builds that view's frame
+    mutable std::unordered_map<quint64, FollowEnvelope<SignalHistory<ValueT, DomainT>>> followEnvelopes;
+
+    // Reusable read buffers in native types; on a linear domain only domainBuffer[0] is read
+    std::vector<ValueT> valueBuffer;
+    std::vector<DomainT> domainBuffer;
+    size_t bufferedCount = 0;  // Samples of the last read not stored yet
+};
+
+// Sample types the plotter reads natively; anything else is read as Float64 / Int64
+daq::SampleType nativeReadValueType(daq::SampleType sampleType);
+daq::SampleType nativeReadDomainType(daq::SampleType sampleType);
+
+// Read type of a post-scaled signal: Float32 where it keeps the signal's precision
+// (Float32 output, or raw samples of at most 16 bits), Float64 otherwise
+daq::SampleType scaledReadValueType(daq::SampleType rawType, daq::ScaledSampleType outputType);
+
+// Create the read path for (already normalised) native read types
+std::unique_ptr<ISignalPath> createSignalPath(daq::SampleType valueType, daq::SampleType domainType);
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
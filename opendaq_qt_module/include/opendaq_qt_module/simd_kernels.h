@@ -0,0 +1,60 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Hot loops of the downsamplers over structure-of-arrays data.
+// Each kernel has a scalar, an SSE2 and an AVX2 version; the widest one the CPU
+// supports is picked once at runtime. All versions return exactly what the
+// scalar loop returns (same operations in the same order per element, ties
+// resolved to the earliest index, NaN handled like the scalar comparisons).
+namespace Kernels
+{
+
+// Index of the first minimum and of the first maximum of values[0, count), count > 0
+void minMaxIndex(const double* values, int count, int& minIdx, int& maxIdx);
+
+// LTTB triangle search: index in [0, count) of the first point j with the largest
+// |(avgX - timeA) * (values[j] - valA) - (times[j] - timeA) * (avgY - valA)|,
+// 0 if no area is a number
+int largestTriangleIndex(const double* times, const double* values, int count,
+                         double timeA, double valA, double avgX, double avgY);
+
+enum class Crossing
+{
+    Rising,   // values[i - 1] < level <= values[i]
+    Falling,  // values[i - 1] > level >= values[i]
+    Above     // level <= values[i]
+};
+
+// Index of the first i in [0, count) where values cross `level`, count if none.
+// Rising and Falling compare with the previous value, so they start at i = 1.
+int firstCrossing(const double* values, int count, double level, Crossing crossing);
+
+// Sums and extremes of a block of samples, for merging into running statistics
+struct BlockMoments
+{
+    int count = 0;            // Values that are numbers; NaN is skipped
+    double min = 0.0;         // Of those, +inf and -inf if there are none
+    double max = 0.0;
+    double sum = 0.0;
+    double sumSquares = 0.0;  // Sum of value^2
+    double m2 = 0.0;          // Sum of (value - sum / count)^2
+};
+
+// Moments of values[0, count). The sums are built in four interleaved lanes (value i
+// goes to lane i % 4) that are combined as (0 + 1) + (2 + 3), in every version, so
+// all of them return the same sums to the bit.
+void blockMoments(const double* values, int count, BlockMoments& moments);
+
+// Name of the instruction set the kernels dispatch to ("AVX2", "SSE2" or "scalar")
+const char* instructionSet();
+
+}  // namespace Kernels
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
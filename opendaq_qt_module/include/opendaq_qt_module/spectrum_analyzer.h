@@ -0,0 +1,101 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/fft.h>
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+enum class SpectrumWindow
+{
+    Rectangular = 0,
+    Hann = 1,
+    Hamming = 2,
+    BlackmanHarris = 3,  // 4-term, -92 dB side lobes
+    FlatTop = 4          // Amplitude accurate between bins
+};
+
+enum class SpectrumAveraging
+{
+    None = 0,         // Latest spectrum
+    Linear = 1,       // Mean of AverageCount spectra, then a new average starts
+    Exponential = 2,  // Each spectrum weighs 1 / AverageCount
+    PeakHold = 3      // Maximum per bin
+};
+
+struct SpectrumSettings
+{
+    size_t fftSize = 4096;  // Supported by RealFft
+    SpectrumWindow window = SpectrumWindow::Hann;
+    double overlap = 0.5;   // Fraction of a block shared with the previous one, [0, 0.95]
+    SpectrumAveraging averaging = SpectrumAveraging::None;
+    int averageCount = 10;
+
+    bool operator==(const SpectrumSettings& other) const
+    {
+        return fftSize == other.fftSize && window == other.window && overlap == other.overlap &&
+               averaging == other.averaging && averageCount == other.averageCount;
+    }
+    bool operator!=(const SpectrumSettings& other) const { return !(*this == other); }
+};
+
+// Averaged power spectrum of a sample stream. Samples are collected into blocks of
+// fftSize, one block every fftSize * (1 - overlap) samples; every block is windowed,
+// transformed and folded into the average. Bins hold the power of the amplitude of a
+// sine at the bin frequency (peak amplitude squared, corrected for the window's gain).
+// All buffers are kept between calls, so a running analyser does not allocate.
+class SpectrumAnalyzer
+{
+public:
+    // Called with power() after every spectrum
+    using SpectrumCallback = std::function<void(const std::vector<double>& power)>;
+
+    // Changed settings restart the analysis
+    void configure(const SpectrumSettings& newSettings);
+    const SpectrumSettings& config() const { return settings; }
+
+    void reset();            // Drop the partial block and the average
+    void resetAverage();     // Keep the samples, start a new average
+
+    // Feed samples; returns the number of spectra computed from them
+    size_t push(const double* values, size_t count, const SpectrumCallback& onSpectrum = {});
+
+    size_t bins() const { return averaged.size(); }
+    size_t hopSize() const { return hop; }  // Samples per spectrum
+    bool hasSpectrum() const { return spectrumCount > 0; }
+    const std::vector<double>& power() const { return averaged; }  // Averaged power per bin, DC to Nyquist
+
+private:
+    void prepare();
+    void transformBlock();
+    void accumulate();
+
+    SpectrumSettings settings;
+    std::shared_ptr<const RealFft> fft;
+    size_t hop = 0;  // Samples between block starts
+
+    std::vector<double> window;
+    std::vector<double> binScale;  // |X|^2 to amplitude^2 per bin
+
+    std::vector<double> block;     // Samples of the next block, `filled` of them valid
+    size_t filled = 0;
+    std::vector<double> windowed;
+    std::vector<std::complex<double>> transformed;
+    std::vector<double> latest;    // Power of the last block
+
+    std::vector<double> sum;       // Linear: power of the running average
+    int sumCount = 0;
+    bool averageComplete = false;  // Linear: `averaged` holds a finished average
+    std::vector<double> averaged;
+    size_t spectrumCount = 0;      // Spectra since the last reset
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,49 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/spectrum_analyzer.h>
+#include <opendaq/event_packet_ptr.h>
+#include <opendaq/input_port_ptr.h>
+#include <opendaq/reader_factory.h>
+#include <QtGlobal>
+#include <string>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Input signal of a spectrum view: read as float64 and fed to its analyser
+struct SpectrumSignal
+{
+    daq::InputPortPtr inputPort;
+    quint64 id;  // Stable key of this signal in published frames
+    daq::StreamReaderPtr streamReader;
+
+    std::string caption;
+    bool isSignalConnected = false;
+    double sampleRate = 0.0;  // From the domain descriptor's linear rule, 0 if unknown
+
+    SpectrumAnalyzer analyzer;
+    std::vector<double> readBuffer;  // Kept between reads
+    size_t newSpectra = 0;           // Spectra computed by the last read
+
+    SpectrumSignal(const daq::InputPortPtr& port, quint64 id)
+        : inputPort(port)
+        , id(id)
+        , streamReader(daq::StreamReaderFromPort(port, daq::SampleType::Float64, daq::SampleType::Int64))
+    {
+    }
+
+    // Read everything queued, analysing it if `analyse`; descriptor changes are applied on
+    // the way and restart the analysis. Returns whether the descriptors changed; throws
+    // what the reader throws.
+    bool read(bool analyse, const SpectrumAnalyzer::SpectrumCallback& onSpectrum = {});
+
+private:
+    void applyDescriptors(const daq::EventPacketPtr& eventPacket);
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,346 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/downsampling.h>
+#include <QDir>
+#include <QFile>
+#include <QPointF>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Where and how much of a signal's history may go to disk
+struct SpillConfig
+{
+    QString directory;        // Owned by the store: created on demand, removed with it
+    qint64 budgetBytes = 0;   // 0 disables spilling
+};
+
+// Disk tier of a signal's history for long scrollback.
+// Samples evicted from the in-memory history are appended to fixed-size segment
+// files that are memory-mapped, so only pages a query touches are read back.
+// Every segment keeps a coarse index in memory: min/max summaries of blocks of
+// samples at two strides. A range query binary-searches the segments and the
+// index and reads raw samples only when few enough of them fall into the range,
+// otherwise it draws from the summaries. Once the files exceed the budget the
+// oldest segment is deleted.
+// Segment layout: SegmentSamples times (double, ms) followed by SegmentSamples values.
+template <typename ValueT>
+class SpillStore
+{
+public:
+    static constexpr qint64 SegmentSamples = qint64(1) << 20;
+    static constexpr std::array<int, 2> SummaryShift = {10, 15};  // 1024 and 32768 samples per summary
+
+    SpillStore() = default;
+    ~SpillStore() { setConfig(SpillConfig()); }
+
+    SpillStore(const SpillStore&) = delete;
+    SpillStore& operator=(const SpillStore&) = delete;
+
+    bool isEnabled() const { return config.budgetBytes > 0; }
+    bool isEmpty() const { return segments.empty(); }
+
+    void setConfig(const SpillConfig& newConfig)
+    {
+        if (newConfig.directory != config.directory)
+        {
+            clear();
+            if (!config.directory.isEmpty())
+                QDir(config.directory).removeRecursively();
+        }
+
+        config = newConfig;
+        enforceBudget();
+    }
+
+    void clear() { segments.clear(); }
+
+    // Append samples in time order
+    template <typename History>
+    void append(const History& history, int beginIdx, int endIdx)
+    {
+        for (int i = beginIdx; i < endIdx && isEnabled(); ++i)
+        {
+            if (segments.empty() || segments.back()->count == SegmentSamples)
+            {
+                if (!openSegment())
+                    return;
+                enforceBudget();
+            }
+            segments.back()->append(history.timeAt(i), history.valueAt(i));
+        }
+    }
+
+    double firstTime() const { return segments.front()->firstTime(); }
+    double lastTime() const { return segments.back()->lastTime(); }
+
+    // Linearly interpolated value at `timeMsec`, NaN if outside the stored range
+    double valueAtTime(double timeMsec) const
+    {
+        if (isEmpty() || timeMsec < firstTime() || timeMsec > lastTime())
+            return std::numeric_limits<double>::quiet_NaN();
+
+        // First segment that reaches timeMsec
+        auto it = std::partition_point(segments.begin(), segments.end(),
+                                       [timeMsec](const auto& segment) { return segment->lastTime() < timeMsec; });
+        const Segment& segment = **it;
+        const qint64 right = segment.firstIndexGE(timeMsec);
+        if (right == 0)
+        {
+            if (it == segments.begin())
+                return segment.valueAt(0);
+            const Segment& previous = **(it - 1);
+            return interpolate(previous.timeAt(previous.count - 1), previous.valueAt(previous.count - 1),
+                               segment.timeAt(0), segment.valueAt(0), timeMsec);
+        }
+        return interpolate(segment.timeAt(right - 1), segment.valueAt(right - 1),
+                           segment.timeAt(right), segment.valueAt(right), timeMsec);
+    }
+
+    // Points of [visibleMin, visibleMax], at most maxSamples of them, appended to `points`
+    void visiblePoints(double visibleMin, double visibleMax, DownsampleMethod method, size_t maxSamples, QVector<QPointF>& points) const
+    {
+        if (isEmpty() || visibleMax < firstTime() || visibleMin > lastTime() || maxSamples == 0)
+            return;
+
+        auto first = std::partition_point(segments.begin(), segments.end(),
+                                          [visibleMin](const auto& segment) { return segment->lastTime() < visibleMin; });
+        auto last = std::partition_point(first, segments.end(),
+                                         [visibleMax](const auto& segment) { return segment->firstTime() <= visibleMax; });
+
+        // Sample range per overlapping segment, found through the finest index
+        spans.clear();
+        qint64 rawCount = 0;
+        for (auto it = first; it != last; ++it)
+        {
+            const Segment& segment = **it;
+            const qint64 begin = segment.firstIndexGE(visibleMin, 0);
+            const qint64 end = segment.firstIndexGT(visibleMax, 0);
+            if (begin < end)
+            {
+                spans.push_back({&segment, begin, end});
+                rawCount += end - begin;
+            }
+        }
+
+        // Few enough samples: page them in
+        if (rawCount <= static_cast<qint64>(maxSamples))
+        {
+            points.reserve(points.size() + static_cast<int>(rawCount));
+            for (const Span& span : spans)
+                for (qint64 i = span.begin; i < span.end; ++i)
+                    points.append(QPointF(span.segment->timeAt(i), span.segment->valueAt(i)));
+            return;
+        }
+
+        // Otherwise the finest summary level that keeps the envelope near the target size
+        size_t level = 0;
+        while (level + 1 < SummaryShift.size() && (rawCount >> SummaryShift[level]) > static_cast<qint64>(maxSamples) * 2)
+            ++level;
+
+        auto& envelope = KernelScratch::local().envelope;
+        envelope.resize(0);
+        envelope.reserve(static_cast<int>((rawCount >> SummaryShift[level]) * 2 + 4));
+        for (const Span& span : spans)
+        {
+            const auto& summaries = span.segment->summaries[level];
+            const qint64 firstSummary = span.begin >> SummaryShift[level];
+            const qint64 lastSummary = (span.end - 1) >> SummaryShift[level];
+            for (qint64 s = firstSummary; s <= lastSummary; ++s)
+            {
+                const Summary& summary = summaries[static_cast<size_t>(s)];
+                const bool minFirst = summary.minTime <= summary.maxTime;
+                envelope.append(minFirst ? QPointF(summary.minTime, summary.minValue) : QPointF(summary.maxTime, summary.maxValue));
+                if (summary.minTime != summary.maxTime)
+                    envelope.append(minFirst ? QPointF(summary.maxTime, summary.maxValue) : QPointF(summary.minTime, summary.minValue));
+            }
+        }
+
+        downsampleEnvelope(envelope, method, maxSamples, points);
+    }
+
+    // Last I/O failure, cleared by the call; spilling stops after a failure
+    std::string takeError()
+    {
+        std::string result;
+        result.swap(error);
+        return result;
+    }
+
+private:
+    struct Summary
+    {
+        double minTime = 0.0;
+        double minValue = 0.0;
+        double maxTime = 0.0;
+        double maxValue = 0.0;
+    };
+
+    struct Segment
+    {
+        QFile file;
+        uchar* data = nullptr;
+        double* times = nullptr;
+        ValueT* values = nullptr;
+        qint64 count = 0;
+        std::array<std::vector<Summary>, SummaryShift.size()> summaries;
+
+        ~Segment()
+        {
+            if (data)
+                file.unmap(data);
+            file.close();
+            file.remove();
+        }
+
+        double timeAt(qint64 i) const { return times[i]; }
+        double valueAt(qint64 i) const { return static_cast<double>(values[i]); }
+        double firstTime() const { return times[0]; }
+        double lastTime() const { return times[count - 1]; }
+
+        void append(double time, ValueT value)
+        {
+            times[count] = time;
+            values[count] = value;
+
+            const double widened = static_cast<double>(value);
+            for (size_t level = 0; level < SummaryShift.size(); ++level)
+            {
+                auto& levelSummaries = summaries[level];
+                if ((count & ((qint64(1) << SummaryShift[level]) - 1)) == 0)
+                {
+                    levelSummaries.push_back({time, widened, time, widened});
+                    continue;
+                }
+
+                Summary& summary = levelSummaries.back();
+                if (widened < summary.minValue) { summary.minValue = widened; summary.minTime = time; }
+                if (widened > summary.maxValue) { summary.maxValue = widened; summary.maxTime = time; }
+            }
+            ++count;
+        }
+
+        // First index with time >= timeMsec (count if none); the summary index narrows the search
+        qint64 firstIndexGE(double timeMsec, int level = 0) const
+        {
+            return searchFrom(timeMsec, level, [](double time, double target) { return time < target; });
+        }
+
+        // First index with time > timeMsec (count if none)
+        qint64 firstIndexGT(double timeMsec, int level = 0) const
+        {
+            return searchFrom(timeMsec, level, [](double time, double target) { return time <= target; });
+        }
+
+        template <typename Before>
+        qint64 searchFrom(double timeMsec, int level, Before before) const
+        {
+            // Summaries are in time order; the first sample of summary s is at s << shift
+            const int shift = SummaryShift[level];
+            const auto& levelSummaries = summaries[level];
+            size_t lo = 0;
+            size_t hi = levelSummaries.size();
+            while (lo < hi)
+            {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (before(times[static_cast<qint64>(mid) << shift], timeMsec))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+
+            // The answer lies in summary lo - 1, or is the first sample of summary lo
+            if (lo == 0)
+                return 0;
+            qint64 begin = static_cast<qint64>(lo - 1) << shift;
+            qint64 end = std::min<qint64>(count, static_cast<qint64>(lo) << shift);
+            while (begin < end)
+            {
+                const qint64 mid = begin + (end - begin) / 2;
+                if (before(times[mid], timeMsec))
+                    begin = mid + 1;
+                else
+                    end = mid;
+            }
+            return begin;
+        }
+    };
+
+    static constexpr qint64 segmentBytes() { return SegmentSamples * static_cast<qint64>(sizeof(double) + sizeof(ValueT)); }
+
+    static double interpolate(double t1, double v1, double t2, double v2, double timeMsec)
+    {
+        if (t2 == t1)
+            return v1;
+        return v1 + (timeMsec - t1) / (t2 - t1) * (v2 - v1);
+    }
+
+    bool openSegment()
+    {
+        if (!QDir().mkpath(config.directory))
+            return fail("Cannot create history spill directory " + config.directory.toStdString());
+
+        auto segment = std::make_unique<Segment>();
+        segment->file.setFileName(QDir(config.directory).filePath(QString("segment_%1.bin").arg(nextSegment++)));
+        if (!segment->file.open(QIODevice::ReadWrite | QIODevice::Truncate) || !segment->file.resize(segmentBytes()))
+            return fail("Cannot create history spill segment: " + segment->file.errorString().toStdString());
+
+        segment->data = segment->file.map(0, segmentBytes());
+        if (!segment->data)
+            return fail("Cannot map history spill segment: " + segment->file.errorString().toStdString());
+
+        segment->times = reinterpret_cast<double*>(segment->data);
+        segment->values = reinterpret_cast<ValueT*>(segment->data + SegmentSamples * sizeof(double));
+        segments.push_back(std::move(segment));
+        return true;
+    }
+
+    bool fail(const std::string& message)
+    {
+        error = message;
+        config.budgetBytes = 0;
+        return false;
+    }
+
+    // Oldest segments go first; the one being written always stays, so the budget
+    // is kept to the granularity of one segment
+    void enforceBudget()
+    {
+        while (segments.size() > 1 && static_cast<qint64>(segments.size()) * segmentBytes() > config.budgetBytes)
+            segments.pop_front();
+        if (!isEnabled())
+            clear();
+    }
+
+    // Samples of one segment that a visible range covers
+    struct Span
+    {
+        const Segment* segment;
+        qint64 begin;
+        qint64 end;
+    };
+
+    SpillConfig config;
+    std::deque<std::unique_ptr<Segment>> segments;
+    qint64 nextSegment = 0;
+    std::string error;
+    mutable std::vector<Span> spans;  // visiblePoints scratch, kept between frames
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
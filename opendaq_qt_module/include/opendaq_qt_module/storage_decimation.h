@@ -0,0 +1,108 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QtGlobal>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Folds incoming samples into fixed-width bins before they reach the history.
+// Each bin of `binSize` consecutive samples is stored as its first, min, max and
+// last sample (in time order, duplicates dropped), so at most 4 samples per bin
+// are kept while the envelope and the bin's entry and exit stay exact. The
+// history, downsampling and markers work on these samples like on raw ones.
+// The last bin stays open until it is complete.
+template <typename ValueT, typename DomainT>
+class StorageDecimator
+{
+public:
+    static constexpr size_t SamplesPerBin = 4;
+
+    bool isActive() const { return binSize > 1; }
+    size_t size() const { return binSize; }
+
+    // Change the bin width; the open bin is stored first. 0 or 1 disables folding.
+    template <typename History>
+    void setSize(size_t newSize, History& history)
+    {
+        if (newSize == binSize)
+            return;
+        flush(history);
+        binSize = newSize;
+    }
+
+    // Drop the open bin (history was cleared)
+    void reset() { fill = 0; }
+
+    // Fold n samples; tickAt(i) gives the tick of values[i]
+    template <typename History, typename TickAt>
+    void fold(History& history, const ValueT* values, size_t n, TickAt tickAt)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            const ValueT value = values[i];
+            if (fill == 0)
+            {
+                const Sample sample{tickAt(i), value, 0};
+                first = minimum = maximum = last = sample;
+                fill = 1;
+            }
+            else
+            {
+                if (value < minimum.value)
+                    minimum = {tickAt(i), value, fill};
+                else if (value > maximum.value)
+                    maximum = {tickAt(i), value, fill};
+                last = {tickAt(i), value, fill};
+                ++fill;
+            }
+
+            if (fill == binSize)
+                flush(history);
+        }
+    }
+
+    // Store the open bin as it is
+    template <typename History>
+    void flush(History& history)
+    {
+        if (fill == 0)
+            return;
+
+        std::array<Sample, SamplesPerBin> samples = {first, minimum, maximum, last};
+        std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) { return a.position < b.position; });
+
+        size_t previous = static_cast<size_t>(-1);
+        for (const Sample& sample : samples)
+        {
+            if (sample.position == previous)
+                continue;
+            history.append(sample.tick, sample.value);
+            previous = sample.position;
+        }
+        fill = 0;
+    }
+
+private:
+    struct Sample
+    {
+        DomainT tick;
+        ValueT value;
+        size_t position;  // Within the bin
+    };
+
+    size_t binSize = 0;
+    size_t fill = 0;
+    Sample first{};
+    Sample minimum{};
+    Sample maximum{};
+    Sample last{};
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,61 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <opendaq_qt_module/downsampling.h>
+#include <opendaq_qt_module/simd_kernels.h>
+#include <algorithm>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Oscilloscope mode of the plotter: frames show captures around trigger points
+enum class TriggerMode
+{
+    Off,     // Free-running scroll
+    Auto,    // Triggered, untriggered captures when no trigger comes
+    Normal,  // Only triggered captures
+    Single   // One triggered capture, then stop until re-armed
+};
+
+enum class TriggerEdge
+{
+    Rising,   // Crossing the level upwards
+    Falling,  // Crossing the level downwards
+    Level     // Any sample at or above the level
+};
+
+// First sample at or after `beginIdx` that fires the trigger, -1 if none. The sample
+// before beginIdx takes part in the edge test, so an edge between two read blocks
+// is found. Values are widened block by block for the vectorised search.
+template <typename History>
+int findTrigger(const History& history, int beginIdx, double level, TriggerEdge edge)
+{
+    constexpr int BlockSamples = 4096;
+
+    const Kernels::Crossing crossing = edge == TriggerEdge::Rising    ? Kernels::Crossing::Rising
+                                       : edge == TriggerEdge::Falling ? Kernels::Crossing::Falling
+                                                                      : Kernels::Crossing::Above;
+    const int lookBack = crossing == Kernels::Crossing::Above ? 0 : 1;
+
+    auto& values = KernelScratch::local().values;
+    for (int blockBegin = std::max(beginIdx, lookBack); blockBegin < history.size(); blockBegin += BlockSamples)
+    {
+        const int blockEnd = std::min(history.size(), blockBegin + BlockSamples);
+        const int first = blockBegin - lookBack;
+        values.resize(static_cast<size_t>(blockEnd - first));
+        for (int i = first; i < blockEnd; ++i)
+            values[static_cast<size_t>(i - first)] = static_cast<double>(history.valueAt(i));
+
+        const int count = static_cast<int>(values.size());
+        const int hit = Kernels::firstCrossing(values.data(), count, level, crossing);
+        if (hit < count)
+            return first + hit;
+    }
+    return -1;
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,55 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <array>
+#include <atomic>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Lock-free single-producer/single-consumer handoff of the latest value.
+// The producer fills writeBuffer() and publishes it; the consumer picks up the
+// most recently published value with update() and reads it from readBuffer().
+// Neither side ever waits: values published faster than they are consumed are
+// simply replaced. Slots are reused, so the producer has to rewrite every field
+// it relies on before publishing.
+template <typename T>
+class TripleBuffer
+{
+public:
+    // Producer side
+    T& writeBuffer() { return slots[backIndex]; }
+
+    void publish()
+    {
+        const int previous = middle.exchange(backIndex | FreshBit, std::memory_order_acq_rel);
+        backIndex = previous & IndexMask;
+    }
+
+    // Consumer side: take the latest published value, false if nothing new was published
+    bool update()
+    {
+        if ((middle.load(std::memory_order_acquire) & FreshBit) == 0)
+            return false;
+
+        const int previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & IndexMask;
+        return true;
+    }
+
+    const T& readBuffer() const { return slots[frontIndex]; }
+
+private:
+    static constexpr int IndexMask = 0x3;
+    static constexpr int FreshBit = 0x4;
+
+    std::array<T, 3> slots{};
+    int backIndex = 0;                // Owned by the producer
+    int frontIndex = 1;               // Owned by the consumer
+    std::atomic<int> middle{2};       // Shared slot index plus fresh flag
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
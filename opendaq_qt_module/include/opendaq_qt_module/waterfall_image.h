@@ -0,0 +1,75 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <QImage>
+#include <QRectF>
+#include <QRgb>
+#include <array>
+#include <mutex>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+class QPainter;
+QT_END_NAMESPACE
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+enum class ColorMap
+{
+    Jet = 0,        // Blue - cyan - yellow - red
+    Inferno = 1,    // Black - purple - orange - yellow, perceptually ordered
+    Grayscale = 2
+};
+
+using ColorTable = std::array<QRgb, 256>;
+
+// Colours of the 256 levels of a waterfall row, interpolated once from the map's stops
+ColorTable makeColorTable(ColorMap map);
+
+// Circular image of spectrum rows, newest at the top. A new row overwrites the oldest
+// one and drawing starts at the wrap offset with two blits, so adding a row costs one
+// row of pixels and drawing costs the same however long the waterfall has been running.
+class WaterfallImage
+{
+public:
+    void resize(int width, int rows);  // Clears
+    void clear();
+
+    int width() const { return image.width(); }
+    int rows() const { return image.height(); }
+
+    void addRow(const QRgb* pixels);  // width() pixels
+    void draw(QPainter& painter, const QRectF& target) const;
+
+private:
+    QImage image;
+    int newest = 0;  // Image row of the newest row; older ones follow below it, wrapping around
+};
+
+// Rows on their way from the acquisition thread to the image. Holds at most one image
+// worth of rows: when the GUI falls behind, the oldest ones are dropped, as they would
+// have scrolled out of view anyway.
+class WaterfallRowQueue
+{
+public:
+    // Drops queued rows; rows of another width are not accepted from then on
+    void reset(int width, int rowCapacity);
+
+    void push(const QRgb* row, int width);  // Acquisition thread
+
+    void drain(WaterfallImage& image);  // GUI thread: move the queued rows into the image, oldest first
+
+private:
+    std::mutex mutex;
+    std::vector<QRgb> rows;  // `capacity` rows of `rowWidth` pixels
+    int rowWidth = 0;
+    int capacity = 0;
+    int first = 0;
+    int count = 0;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
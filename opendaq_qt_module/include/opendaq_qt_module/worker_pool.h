@@ -0,0 +1,64 @@
+#pragma once
+#include <opendaq_qt_module/common.h>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+// Fixed set of threads for independent per-signal work (reading, trimming, downsampling).
+// parallelFor runs one task per index on the pool and on the calling thread and
+// returns once all of them finished. Several callers may use the pool at the same
+// time; their indices are handed out in call order.
+class WorkerPool
+{
+public:
+    // Pool sized to the hardware, shared by everyone holding the returned pointer
+    static std::shared_ptr<WorkerPool> shared();
+
+    explicit WorkerPool(size_t threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Threads working on a parallelFor, including the caller
+    size_t concurrency() const { return workers.size() + 1; }
+
+    // Run task(i) for every i in [0, count); rethrows the first exception of a task
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+private:
+    struct Job
+    {
+        const std::function<void(size_t)>* task = nullptr;
+        size_t count = 0;
+        size_t next = 0;       // Next index to hand out
+        size_t remaining = 0;  // Indices not finished yet
+        std::exception_ptr error;
+    };
+
+    bool claim(Job& job, size_t& index);  // Called with mutex held
+    void finish(Job& job, std::exception_ptr error);  // Called with mutex held
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable jobFinished;
+    std::deque<Job*> jobs;  // Jobs with indices left to hand out
+    bool stopping = false;
+};
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
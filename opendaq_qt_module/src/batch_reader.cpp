@@ -0,0 +1,95 @@
+#include <opendaq_qt_module/batch_reader.h>
+#include <opendaq/reader_factory.h>
+#include <coretypes/procedure_factory.h>
+#include <algorithm>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr size_t MinBufferSamples = 200;  // Like the per-signal read buffers
+
+}  // namespace
+
+BatchReader::BatchReader(const std::vector<daq::InputPortPtr>& ports,
+                         daq::SampleType valueType,
+                         daq::SampleType domainType,
+                         std::function<void()> onDataAvailable)
+    : valueSampleType(valueType)
+    , domainSampleType(domainType)
+    , valueBuffers(ports.size())
+    , valuePointers(ports.size())
+    , tickPointers(ports.size())
+{
+    auto builder = daq::MultiReaderBuilder()
+                       .setValueReadType(valueType)
+                       .setDomainReadType(domainType);
+    for (const auto& port : ports)
+        builder.addInputPort(port);
+
+    reader = builder.build();
+    reader.setOnDataAvailable(daq::Procedure([onDataAvailable]() { onDataAvailable(); }));
+}
+
+BatchReader::~BatchReader()
+{
+    if (reader.assigned())
+        reader.setOnDataAvailable(nullptr);
+}
+
+size_t BatchReader::read()
+{
+    const size_t available = reader.getAvailableCount();
+    if (available > bufferSamples)
+    {
+        bufferSamples = std::max(available, MinBufferSamples);
+        for (size_t i = 0; i < valueBuffers.size(); ++i)
+        {
+            valueBuffers[i].resize(bufferSamples);
+            valuePointers[i] = valueBuffers[i].data();
+        }
+        tickBuffer.resize(bufferSamples);
+        std::fill(tickPointers.begin(), tickPointers.end(), tickBuffer.data());
+    }
+
+    daq::SizeT count = available;
+    status = reader.readWithDomain(valuePointers.data(), tickPointers.data(), &count);
+    return count;
+}
+
+bool BatchReader::hasEvent() const
+{
+    return status.assigned() && status.getReadStatus() == daq::ReadStatus::Event;
+}
+
+bool BatchReader::isValid() const
+{
+    return !status.assigned() || status.getValid();
+}
+
+daq::EventPacketPtr BatchReader::eventFor(const daq::InputPortPtr& port) const
+{
+    if (!hasEvent())
+        return nullptr;
+
+    const auto events = status.getEventPackets();
+    if (!events.assigned())
+        return nullptr;
+
+    // Keyed by the global ID of the port, or of its signal
+    if (events.hasKey(port.getGlobalId()))
+        return events.get(port.getGlobalId());
+
+    const auto signal = port.getSignal();
+    if (signal.assigned() && events.hasKey(signal.getGlobalId()))
+        return events.get(signal.getGlobalId());
+    return nullptr;
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,141 @@
+#include <opendaq_qt_module/density_raster.h>
+#include <algorithm>
+#include <cmath>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr double MaxWeight = 1e20;       // Renormalize before float cells lose the old hits
+constexpr double VisibleHits = 0.1;      // Decayed below this, a cell is drawn as empty
+
+}  // namespace
+
+void DensityRaster::resize(int width, int height)
+{
+    if (width == rasterWidth && height == rasterHeight)
+        return;
+
+    rasterWidth = std::max(width, 0);
+    rasterHeight = std::max(height, 0);
+    cells.assign(static_cast<size_t>(rasterWidth) * static_cast<size_t>(rasterHeight), 0.0f);
+    clear();
+}
+
+void DensityRaster::clear()
+{
+    std::fill(cells.begin(), cells.end(), 0.0f);
+    weight = 1.0;
+    peak = 0.0;
+}
+
+void DensityRaster::setRange(double newXMin, double newXMax, double newYMin, double newYMax)
+{
+    if (newXMin == xMin && newXMax == xMax && newYMin == yMin && newYMax == yMax)
+        return;
+
+    xMin = newXMin;
+    xMax = newXMax;
+    yMin = newYMin;
+    yMax = newYMax;
+    clear();
+}
+
+size_t DensityRaster::accumulate(const double* x, const double* y, size_t count)
+{
+    if (cells.empty() || !hasRange())
+        return 0;
+
+    const double xScale = rasterWidth / (xMax - xMin);
+    const double yScale = rasterHeight / (yMax - yMin);
+    const float hit = static_cast<float>(weight);
+    float highest = static_cast<float>(peak);
+
+    size_t inside = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double column = (x[i] - xMin) * xScale;
+        const double row = (y[i] - yMin) * yScale;
+
+        // Also false for NaN
+        if (!(column >= 0.0 && column < rasterWidth && row >= 0.0 && row < rasterHeight))
+            continue;
+
+        float& cell = cells[static_cast<size_t>(row) * static_cast<size_t>(rasterWidth) + static_cast<size_t>(column)];
+        cell += hit;
+        highest = std::max(highest, cell);
+        ++inside;
+    }
+
+    peak = highest;
+    return inside;
+}
+
+void DensityRaster::decay(double factor)
+{
+    if (factor >= 1.0 || empty())
+        return;
+
+    weight /= std::max(factor, 1.0 / MaxWeight);
+    if (weight > MaxWeight)
+        renormalize();
+}
+
+void DensityRaster::renormalize()
+{
+    const float scale = static_cast<float>(1.0 / weight);
+    for (float& cell : cells)
+        cell *= scale;
+    peak /= weight;
+    weight = 1.0;
+
+    // Everything decayed away: start over
+    if (peak < VisibleHits)
+        clear();
+}
+
+void DensityRaster::render(const ColorTable& colors, QRgb* pixels)
+{
+    const size_t width = static_cast<size_t>(rasterWidth);
+    const QRgb background = colors.front();
+    if (empty())
+    {
+        std::fill(pixels, pixels + width * static_cast<size_t>(rasterHeight), background);
+        return;
+    }
+
+    // Colours per step of cell / peak, logarithmic in hits; a handful of logs per frame instead of one per cell
+    const double peakHits = peak / weight;
+    const double logPeak = std::log1p(peakHits);
+    const size_t steps = levelColors.size() - 1;
+    for (size_t step = 0; step <= steps; ++step)
+    {
+        const double hits = peakHits * static_cast<double>(step) / static_cast<double>(steps);
+        const double level = logPeak > 0.0 ? std::log1p(hits) / logPeak : 1.0;
+        // Level 0 stays the background; any visible cell gets at least the first colour above it
+        levelColors[step] = colors[static_cast<size_t>(std::clamp(1.0 + level * 254.0, 1.0, 255.0))];
+    }
+
+    const float threshold = static_cast<float>(VisibleHits * weight);
+    const float stepScale = static_cast<float>(static_cast<double>(steps) / peak);
+    for (int row = 0; row < rasterHeight; ++row)
+    {
+        const float* source = cells.data() + static_cast<size_t>(row) * width;
+        QRgb* target = pixels + static_cast<size_t>(rasterHeight - 1 - row) * width;
+        for (size_t column = 0; column < width; ++column)
+        {
+            const float cell = source[column];
+            target[column] = cell < threshold
+                                 ? background
+                                 : levelColors[std::min(static_cast<size_t>(std::ceil(cell * stepScale)), steps)];
+        }
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
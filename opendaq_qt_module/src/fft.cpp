@@ -0,0 +1,270 @@
+#include <opendaq_qt_module/fft.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+using Complex = std::complex<double>;
+
+constexpr double Pi = 3.14159265358979323846;
+
+// Work buffers of the calling thread, kept at the size of the largest transform it ran
+struct FftScratch
+{
+    std::vector<Complex> first;
+    std::vector<Complex> second;
+
+    static FftScratch& local()
+    {
+        thread_local FftScratch scratch;
+        return scratch;
+    }
+};
+
+// exp(-2 pi i index / length)
+Complex unitRoot(size_t index, size_t length)
+{
+    const double angle = -2.0 * Pi * static_cast<double>(index % length) / static_cast<double>(length);
+    return {std::cos(angle), std::sin(angle)};
+}
+
+// Plain products; std::complex multiplication checks for infinities on every call
+inline Complex mul(const Complex& a, const Complex& b)
+{
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+
+inline Complex mulMinusI(const Complex& a)
+{
+    return {a.imag(), -a.real()};
+}
+
+bool isSmooth(size_t value)
+{
+    for (size_t factor : {2, 3, 5})
+        while (value % factor == 0)
+            value /= factor;
+    return value == 1;
+}
+
+// One Stockham pass: splits `stride` interleaved transforms of `length` points into
+// radix-point butterflies and writes them, twiddled, in autosorted order
+template <int Radix>
+void runStage(const Complex* in, Complex* out, size_t length, size_t stride, const Complex* twiddles)
+{
+    const size_t span = length / Radix;
+
+    for (size_t p = 0; p < span; ++p)
+    {
+        const Complex* w = twiddles + p * (Radix - 1);
+        for (size_t q = 0; q < stride; ++q)
+        {
+            Complex a[Radix];
+            for (int j = 0; j < Radix; ++j)
+                a[j] = in[q + stride * (p + j * span)];
+
+            Complex b[Radix];
+            if constexpr (Radix == 2)
+            {
+                b[0] = a[0] + a[1];
+                b[1] = a[0] - a[1];
+            }
+            else if constexpr (Radix == 4)
+            {
+                const Complex s02 = a[0] + a[2];
+                const Complex d02 = a[0] - a[2];
+                const Complex s13 = a[1] + a[3];
+                const Complex d13 = mulMinusI(a[1] - a[3]);
+                b[0] = s02 + s13;
+                b[1] = d02 + d13;
+                b[2] = s02 - s13;
+                b[3] = d02 - d13;
+            }
+            else if constexpr (Radix == 3)
+            {
+                constexpr double HalfSqrt3 = 0.86602540378443864676;
+                const Complex sum = a[1] + a[2];
+                const Complex mid = a[0] - 0.5 * sum;
+                const Complex rot = HalfSqrt3 * mulMinusI(a[1] - a[2]);
+                b[0] = a[0] + sum;
+                b[1] = mid + rot;
+                b[2] = mid - rot;
+            }
+            else
+            {
+                static_assert(Radix == 5, "Unsupported radix");
+                constexpr double c1 = 0.30901699437494742410;   // cos(2 pi / 5)
+                constexpr double c2 = -0.80901699437494742410;  // cos(4 pi / 5)
+                constexpr double s1 = 0.95105651629515357212;   // sin(2 pi / 5)
+                constexpr double s2 = 0.58778525229247312917;   // sin(4 pi / 5)
+                const Complex t1 = a[1] + a[4];
+                const Complex t2 = a[2] + a[3];
+                const Complex d1 = a[1] - a[4];
+                const Complex d2 = a[2] - a[3];
+                const Complex m1 = a[0] + c1 * t1 + c2 * t2;
+                const Complex m2 = a[0] + c2 * t1 + c1 * t2;
+                const Complex r1 = mulMinusI(s1 * d1 + s2 * d2);
+                const Complex r2 = mulMinusI(s2 * d1 - s1 * d2);
+                b[0] = a[0] + t1 + t2;
+                b[1] = m1 + r1;
+                b[4] = m1 - r1;
+                b[2] = m2 + r2;
+                b[3] = m2 - r2;
+            }
+
+            Complex* target = out + q + stride * (Radix * p);
+            target[0] = b[0];
+            for (int k = 1; k < Radix; ++k)
+                target[stride * k] = mul(b[k], w[k - 1]);
+        }
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<const RealFft> RealFft::plan(size_t size)
+{
+    // Held by the analysers using them, like the worker pool
+    static std::mutex plansMutex;
+    static std::map<size_t, std::weak_ptr<const RealFft>> plans;
+
+    std::lock_guard<std::mutex> lock(plansMutex);
+    auto& entry = plans[size];
+    auto fft = entry.lock();
+    if (!fft)
+    {
+        fft = std::make_shared<const RealFft>(size);
+        entry = fft;
+    }
+    return fft;
+}
+
+size_t RealFft::supportedSize(size_t size)
+{
+    size_t candidate = std::max<size_t>(size, 2);
+    candidate += candidate % 2;
+    while (!isSmooth(candidate))
+        candidate += 2;
+    return candidate;
+}
+
+bool RealFft::isSupported(size_t size)
+{
+    return size >= 2 && size % 2 == 0 && isSmooth(size);
+}
+
+RealFft::RealFft(size_t size)
+    : fftSize(size)
+    , halfSize(size / 2)
+{
+    if (!isSupported(size))
+        throw std::invalid_argument("FFT size must be even with prime factors 2, 3 and 5 only");
+
+    // Radix-4 stages do the bulk, the rest is a single radix-2 stage and the odd factors
+    std::vector<int> radices;
+    size_t remaining = halfSize;
+    while (remaining % 4 == 0)
+    {
+        radices.push_back(4);
+        remaining /= 4;
+    }
+    if (remaining % 2 == 0)
+    {
+        radices.push_back(2);
+        remaining /= 2;
+    }
+    for (int radix : {3, 5})
+    {
+        while (remaining % radix == 0)
+        {
+            radices.push_back(radix);
+            remaining /= radix;
+        }
+    }
+
+    size_t length = halfSize;
+    size_t stride = 1;
+    for (int radix : radices)
+    {
+        stages.push_back({radix, length, stride, twiddles.size()});
+
+        const size_t span = length / radix;
+        for (size_t p = 0; p < span; ++p)
+            for (int k = 1; k < radix; ++k)
+                twiddles.push_back(unitRoot(p * k, length));
+
+        length = span;
+        stride *= radix;
+    }
+
+    splitTwiddles.resize(fftSize / 4 + 1);
+    for (size_t k = 0; k < splitTwiddles.size(); ++k)
+        splitTwiddles[k] = unitRoot(k, fftSize);
+}
+
+void RealFft::transform(const double* input, Complex* output) const
+{
+    auto& scratch = FftScratch::local();
+    if (scratch.first.size() < halfSize)
+    {
+        scratch.first.resize(halfSize);
+        scratch.second.resize(halfSize);
+    }
+
+    // Even samples as real, odd samples as imaginary parts
+    Complex* in = scratch.first.data();
+    Complex* out = scratch.second.data();
+    for (size_t i = 0; i < halfSize; ++i)
+        in[i] = {input[2 * i], input[2 * i + 1]};
+
+    for (const Stage& stage : stages)
+    {
+        const Complex* w = twiddles.data() + stage.twiddleOffset;
+        switch (stage.radix)
+        {
+            case 4:
+                runStage<4>(in, out, stage.length, stage.stride, w);
+                break;
+            case 2:
+                runStage<2>(in, out, stage.length, stage.stride, w);
+                break;
+            case 3:
+                runStage<3>(in, out, stage.length, stage.stride, w);
+                break;
+            default:
+                runStage<5>(in, out, stage.length, stage.stride, w);
+                break;
+        }
+        std::swap(in, out);
+    }
+
+    // Split the half-size spectrum Z into the spectra of the even (E) and odd (O) samples:
+    // X[k] = E[k] + W^k O[k] and X[M - k] = conj(E[k] - W^k O[k]), with M = size / 2
+    const Complex* z = in;
+    for (size_t k = 0; k <= halfSize / 2; ++k)
+    {
+        const Complex a = z[k];
+        const Complex b = std::conj(z[k == 0 ? 0 : halfSize - k]);
+        const Complex even = 0.5 * (a + b);
+        const Complex odd = 0.5 * mulMinusI(a - b);
+        const Complex rotated = mul(splitTwiddles[k], odd);
+
+        output[k] = even + rotated;
+        if (halfSize - k != k)
+            output[halfSize - k] = std::conj(even - rotated);
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,413 @@
+#include <opendaq_qt_module/history_cache.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/input_port_factory.h>
+#include <QDateTime>
+#include <QString>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+// Ticks are converted to plot time by the history itself (origin + ticks * resolution)
+DomainMapping domainMappingOf(const daq::DataDescriptorPtr& domainDescriptor)
+{
+    DomainMapping mapping;
+    auto tickResolution = domainDescriptor.getTickResolution();
+    if (tickResolution.assigned() && tickResolution.getDenominator() != 0)
+    {
+        const double secondsPerTick = static_cast<double>(tickResolution.getNumerator()) /
+                                      static_cast<double>(tickResolution.getDenominator());
+        if (secondsPerTick > 0.0)
+            mapping.msPerTick = secondsPerTick * 1000.0;
+    }
+
+    auto origin = domainDescriptor.getOrigin();
+    if (origin.assigned() && !origin.toStdString().empty())
+    {
+        QDateTime originTime = QDateTime::fromString(QString::fromStdString(origin.toStdString()), Qt::ISODate);
+        if (originTime.isValid())
+            mapping.originMs = static_cast<double>(originTime.toMSecsSinceEpoch());
+    }
+    return mapping;
+}
+
+// Whole ticks per sample of a linear-rule domain: timestamps can be computed instead of read; 0 otherwise
+qint64 linearDeltaOf(const daq::DataDescriptorPtr& domainDescriptor)
+{
+    auto rule = domainDescriptor.getRule();
+    if (!rule.assigned() || rule.getType() != daq::DataRuleType::Linear)
+        return 0;
+
+    const double delta = rule.getParameters().get("delta");
+    if (delta >= 1.0 && delta == std::floor(delta))
+        return static_cast<qint64>(delta);
+    return 0;
+}
+
+}  // namespace
+
+SharedHistory::SharedHistory(const daq::SignalPtr& signal)
+    : path(createSignalPath(daq::SampleType::Float64, daq::SampleType::Int64))
+{
+    if (!signal.assigned())
+        return;
+
+    // Gap packets stop reads at domain gaps, so a linear domain is only read once per block
+    port = daq::InputPort(signal.getContext(), nullptr, "HistoryCache", true);
+    reader = daq::StreamReaderFromPort(port, daq::SampleType::Float64, daq::SampleType::Int64);
+    port.connect(signal);
+}
+
+SharedHistory::~SharedHistory()
+{
+    if (port.assigned())
+        port.disconnect();
+}
+
+void SharedHistory::subscribe(quint64 subscriber, std::function<void()> onStored)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    subscribers[subscriber].onStored = std::move(onStored);
+}
+
+void SharedHistory::unsubscribe(quint64 subscriber)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    subscribers.erase(subscriber);
+    path->releaseView(subscriber);
+    applySettings();
+}
+
+size_t SharedHistory::read(quint64 subscriber)
+{
+    std::unique_lock<std::mutex> readLock(readMutex, std::try_to_lock);
+    if (!readLock.owns_lock() || !reader.assigned())
+        return 0;
+
+    size_t stored = 0;
+    while (true)
+    {
+        // Only the read buffers of the path are filled here; queries keep running on the history
+        daq::ReaderStatusPtr status;
+        const size_t count = path->read(reader, reader.getAvailableCount(), status);
+        if (count > 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            path->storeRead();
+            trim();
+            stored += count;
+        }
+
+        // Reads stop at events; after a descriptor change the rest is read in the new types
+        if (!status.assigned() || status.getReadStatus() != daq::ReadStatus::Event)
+            break;
+        applyEvent(status.getEventPacket());
+    }
+
+    if (stored > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++storeVersion;
+        for (const auto& [key, settings] : subscribers)
+        {
+            if (key != subscriber && settings.onStored)
+                settings.onStored();
+        }
+    }
+    return stored;
+}
+
+quint64 SharedHistory::version() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return storeVersion;
+}
+
+void SharedHistory::applyEvent(const daq::EventPacketPtr& eventPacket)
+{
+    // Gap events only end a block; the next read is anchored on its own first sample
+    if (!eventPacket.assigned() || eventPacket.getEventId() != event_packet_id::DATA_DESCRIPTOR_CHANGED)
+        return;
+
+    const daq::DataDescriptorPtr descriptor = eventPacket.getParameters()[event_packet_param::DATA_DESCRIPTOR];
+    const daq::DataDescriptorPtr domainDescriptor = eventPacket.getParameters()[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
+
+    // Values and ticks are read in the types the signal carries
+    daq::SampleType valueType = reader.getValueReadType();
+    if (descriptor.assigned())
+    {
+        auto postScaling = descriptor.getPostScaling();
+        if (postScaling.assigned())
+            valueType = scaledReadValueType(postScaling.getInputSampleType(), postScaling.getOutputSampleType());
+        else
+            valueType = nativeReadValueType(descriptor.getSampleType());
+    }
+    daq::SampleType domainType = reader.getDomainReadType();
+    if (domainDescriptor.assigned())
+        domainType = nativeReadDomainType(domainDescriptor.getSampleType());
+
+    // Re-created with the new read types, keeping its connection and queued packets
+    if (valueType != reader.getValueReadType() || domainType != reader.getDomainReadType())
+        reader = daq::StreamReaderFromExisting(reader, valueType, domainType);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (domainDescriptor.assigned())
+    {
+        domainMapping = domainMappingOf(domainDescriptor);
+        linearDelta = linearDeltaOf(domainDescriptor);
+    }
+
+    if (valueType != path->valueType() || domainType != path->domainType())
+    {
+        path = createSignalPath(valueType, domainType);
+        for (auto& [key, settings] : subscribers)
+            settings.clearedUpTo = -std::numeric_limits<double>::infinity();
+        historySec = -1.0;  // Reserve the new path
+        applySettings();
+        ++storeVersion;
+    }
+    path->setDomainMapping(domainMapping);
+    path->setLinearDomain(linearDelta);
+}
+
+void SharedHistory::setHistory(quint64 subscriber, double durationSec, double sampleRate)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = subscribers.find(subscriber);
+    if (it == subscribers.end())
+        return;
+
+    it->second.durationSec = durationSec;
+    it->second.sampleRate = sampleRate;
+    applySettings();
+}
+
+void SharedHistory::setStorageDecimation(quint64 subscriber, size_t binSize)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = subscribers.find(subscriber);
+    if (it == subscribers.end() || it->second.binSize == binSize)
+        return;
+
+    it->second.binSize = binSize;
+    applySettings();
+}
+
+void SharedHistory::setSpill(quint64 subscriber, const SpillConfig& config)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = subscribers.find(subscriber);
+    if (it == subscribers.end())
+        return;
+
+    it->second.spill = config;
+    applySettings();
+}
+
+std::string SharedHistory::takeSpillError(quint64 subscriber)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (subscriber != spillOwner())
+        return {};
+    return path->takeSpillError();
+}
+
+void SharedHistory::trim()
+{
+    if (path->isEmpty())
+        return;
+
+    // Older samples move to the disk tier if the largest DiskBudget allows.
+    // Eviction only advances the ring head, so its cost does not depend on history length
+    const double minTimeToKeep = path->lastTime() - historySec * 1000.0;
+    if (minTimeToKeep > 0)
+        path->evictBefore(minTimeToKeep);
+}
+
+void SharedHistory::clear(quint64 subscriber)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = subscribers.find(subscriber);
+    if (it == subscribers.end() || path->isEmpty())
+        return;
+
+    // Other subscribers may still show the samples; they go once nobody does
+    const double last = path->lastTime();
+    it->second.clearedUpTo = last;
+    const bool clearedByAll = std::all_of(subscribers.begin(), subscribers.end(),
+                                          [last](const auto& entry) { return entry.second.clearedUpTo >= last; });
+    if (clearedByAll)
+    {
+        path->clear();
+        for (auto& [key, settings] : subscribers)
+            settings.clearedUpTo = -std::numeric_limits<double>::infinity();
+    }
+    ++storeVersion;
+
+    // Incremental points may still hold cleared samples
+    path->releaseView(subscriber);
+}
+
+bool SharedHistory::isEmpty(quint64 subscriber) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return path->isEmpty() || path->lastTime() <= visibleAfter(subscriber);
+}
+
+double SharedHistory::firstTime(quint64 subscriber) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::max(path->firstTime(), visibleAfter(subscriber));
+}
+
+double SharedHistory::lastTime() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return path->lastTime();
+}
+
+double SharedHistory::valueAtTime(quint64 subscriber, double timeMsec) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (timeMsec <= visibleAfter(subscriber))
+        return std::numeric_limits<double>::quiet_NaN();
+    return path->valueAtTime(timeMsec);
+}
+
+RangeStatistics SharedHistory::statistics(quint64 subscriber, double fromMsec, double toMsec) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const double after = visibleAfter(subscriber);
+    if (fromMsec <= after)
+        fromMsec = std::nextafter(after, std::numeric_limits<double>::infinity());
+    if (fromMsec > toMsec)
+        return {};
+    return path->statistics(fromMsec, toMsec);
+}
+
+double SharedHistory::findTrigger(quint64 subscriber, double afterMsec, double level, TriggerEdge edge) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return path->findTrigger(std::max(afterMsec, visibleAfter(subscriber)), level, edge);
+}
+
+void SharedHistory::visiblePoints(quint64 subscriber, VisibleRequest request, QVector<QPointF>& points) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const double after = visibleAfter(subscriber);
+    if (request.visibleMin <= after)
+        request.visibleMin = std::nextafter(after, std::numeric_limits<double>::infinity());
+    if (request.visibleMin >= request.visibleMax)
+        return;
+
+    request.viewKey = subscriber;
+    path->visiblePoints(request, points);
+}
+
+SharedHistory::MemoryShare SharedHistory::memoryShare() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const size_t sharers = std::max<size_t>(subscribers.size(), 1);
+    return {path->memoryBytes() / sharers, path->committedBytes() / sharers};
+}
+
+double SharedHistory::visibleAfter(quint64 subscriber) const
+{
+    // A clear past the newest sample: the domain went back in time, the samples are new
+    auto it = subscribers.find(subscriber);
+    if (it == subscribers.end() || path->isEmpty() || it->second.clearedUpTo > path->lastTime())
+        return -std::numeric_limits<double>::infinity();
+    return it->second.clearedUpTo;
+}
+
+void SharedHistory::applySettings()
+{
+    // Longest history, finest bins (0 = raw samples wins); the rate is the same for everyone
+    double durationSec = 0.0;
+    double sampleRate = 0.0;
+    size_t binSize = 0;
+    bool first = true;
+    for (const auto& [key, settings] : subscribers)
+    {
+        durationSec = std::max(durationSec, settings.durationSec);
+        sampleRate = std::max(sampleRate, settings.sampleRate);
+        binSize = first ? settings.binSize : std::min(binSize, settings.binSize);
+        first = false;
+    }
+
+    if (durationSec != historySec || sampleRate != historyRate)
+    {
+        historySec = durationSec;
+        historyRate = sampleRate;
+        path->reserveFor(historySec, historyRate);
+    }
+    path->setStorageDecimation(binSize);
+
+    auto it = subscribers.find(spillOwner());
+    path->setSpill(it != subscribers.end() ? it->second.spill : SpillConfig());
+}
+
+quint64 SharedHistory::spillOwner() const
+{
+    // Does not depend on who reads, so the disk tier stays where it is
+    quint64 owner = 0;
+    qint64 budget = 0;
+    for (const auto& [key, settings] : subscribers)
+    {
+        if (settings.spill.budgetBytes > budget)
+        {
+            owner = key;
+            budget = settings.spill.budgetBytes;
+        }
+    }
+    return owner;
+}
+
+HistoryCache& HistoryCache::instance()
+{
+    static HistoryCache cache;
+    return cache;
+}
+
+quint64 HistoryCache::newSubscriber()
+{
+    static std::atomic<quint64> nextSubscriber{1};
+    return nextSubscriber++;
+}
+
+std::shared_ptr<SharedHistory> HistoryCache::subscribe(const daq::SignalPtr& signal, quint64 subscriber, std::function<void()> onStored)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto it = histories.begin(); it != histories.end();)
+    {
+        if (it->second.expired())
+            it = histories.erase(it);
+        else
+            ++it;
+    }
+
+    // One reader per signal, owned by its history, whichever plotter subscribed first
+    auto& entry = histories[signal.getGlobalId().toStdString()];
+    auto history = entry.lock();
+    if (!history)
+    {
+        history = std::make_shared<SharedHistory>(signal);
+        entry = history;
+    }
+    history->subscribe(subscriber, std::move(onStored));
+    return history;
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,114 @@
+#include <opendaq_qt_module/history_governor.h>
+#include <algorithm>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+HistoryGovernor& HistoryGovernor::instance()
+{
+    static HistoryGovernor governor;
+    return governor;
+}
+
+quint64 HistoryGovernor::registerClient()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const quint64 client = nextClient++;
+    clients[client].report.lastViewed = Clock::now();
+    return client;
+}
+
+void HistoryGovernor::unregisterClient(quint64 client)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    clients.erase(client);
+}
+
+void HistoryGovernor::setBudget(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    budgetBytes = bytes;
+}
+
+size_t HistoryGovernor::budget() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return budgetBytes;
+}
+
+int HistoryGovernor::report(quint64 client, const Report& report)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = clients.find(client);
+    if (it == clients.end())
+        return 0;
+
+    Client& entry = it->second;
+    entry.report = report;
+    entry.level = std::clamp(entry.level, 0, std::max(report.maxLevel, 0));
+
+    rebalance(Clock::now());
+    return entry.level;
+}
+
+void HistoryGovernor::rebalance(Clock::time_point now)
+{
+    if (budgetBytes == 0)
+    {
+        for (auto& [key, entry] : clients)
+            entry.level = 0;
+        return;
+    }
+
+    if (now - lastStep < StepInterval)
+        return;
+
+    size_t total = 0;
+    for (const auto& [key, entry] : clients)
+        total += entry.report.bytes;
+
+    if (total > budgetBytes)
+    {
+        // Least recently viewed first; among equals the one holding more memory
+        Client* victim = nullptr;
+        for (auto& [key, entry] : clients)
+        {
+            if (entry.level >= entry.report.maxLevel || entry.report.bytes == 0)
+                continue;
+            if (!victim || entry.report.lastViewed < victim->report.lastViewed
+                || (entry.report.lastViewed == victim->report.lastViewed && entry.report.bytes > victim->report.bytes))
+                victim = &entry;
+        }
+
+        if (victim)
+        {
+            ++victim->level;
+            lastStep = now;
+        }
+        return;
+    }
+
+    // Undoing a halving doubles a plotter's history (undoing decimation grows it by more,
+    // until the raw samples come in); only restore with room to spare, or the next
+    // evaluation would take it back
+    Client* favourite = nullptr;
+    for (auto& [key, entry] : clients)
+    {
+        if (entry.level == 0)
+            continue;
+        if (!favourite || entry.report.lastViewed > favourite->report.lastViewed)
+            favourite = &entry;
+    }
+
+    if (favourite && static_cast<double>(total + favourite->report.bytes) < static_cast<double>(budgetBytes) * RestoreRatio)
+    {
+        --favourite->level;
+        lastStep = now;
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,238 @@
+#include <opendaq_qt_module/live_view.h>
+#include <frame_clock_interface/frame_clock_interface.h>
+#include <QEvent>
+#include <QObject>
+#include <QTimer>
+#include <QWidget>
+#include <algorithm>
+#include <utility>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+// Tracks whether the view's widget is on screen and takes the frame clock's frame events
+class LiveViewFilter : public QObject
+{
+public:
+    LiveViewFilter(QWidget* widget, LiveView* view)
+        : QObject(widget)
+        , view(view)
+    {}
+
+    ~LiveViewFilter() override
+    {
+        // Destroyed together with the widget
+        if (view)
+            view->setVisible(false);
+    }
+
+    void detach() { view = nullptr; }
+
+protected:
+    bool eventFilter(QObject* obj, QEvent* event) override
+    {
+        if (view && event->type() == FrameClockInterface::FrameEvent)
+        {
+            view->renderFrame();
+            return true;
+        }
+
+        // Hidden tabs and minimised windows get (spontaneous) hide events
+        if (view && event->type() == QEvent::Show)
+            view->setVisible(true);
+        else if (view && event->type() == QEvent::Hide)
+            view->setVisible(false);
+
+        return QObject::eventFilter(obj, event);
+    }
+
+private:
+    LiveView* view;
+};
+
+}  // namespace
+
+LiveView::LiveView(std::function<void()> onAcquire, std::function<void()> onRender)
+    : acquireCallback(std::move(onAcquire))
+    , renderCallback(std::move(onRender))
+{
+}
+
+LiveView::~LiveView()
+{
+    if (auto* filter = static_cast<LiveViewFilter*>(visibilityFilter.data()))
+        filter->detach();
+    stop();
+}
+
+void LiveView::start()
+{
+    if (!thread.joinable())
+        thread = std::thread(&LiveView::loop, this);
+}
+
+void LiveView::stop()
+{
+    {
+        std::lock_guard<std::mutex> wakeLock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+
+    if (thread.joinable())
+        thread.join();
+}
+
+void LiveView::wake()
+{
+    {
+        std::lock_guard<std::mutex> wakeLock(wakeMutex);
+        pending = true;
+    }
+    wakeCondition.notify_one();
+}
+
+void LiveView::packetReceived()
+{
+    if (!dataPending.exchange(true))
+        wake();
+}
+
+void LiveView::invalidate()
+{
+    invalidated = true;
+    wake();
+}
+
+void LiveView::setMaxFps(int fps)
+{
+    maxFps = std::max(fps, 1);
+}
+
+bool LiveView::takeInvalidated()
+{
+    return invalidated.exchange(false);
+}
+
+void LiveView::loop()
+{
+    using Clock = std::chrono::steady_clock;
+
+    // While hidden, readers are still drained so their queues do not grow, but rarely
+    constexpr auto HiddenDrainPeriod = std::chrono::milliseconds(500);
+    // Slowest frame rate backing off can reach
+    constexpr auto MaxFrameInterval = std::chrono::milliseconds(1000);
+
+    Clock::time_point nextFrame = Clock::now();
+
+    std::unique_lock<std::mutex> wakeLock(wakeMutex);
+    while (!stopping)
+    {
+        if (viewVisible)
+            wakeCondition.wait(wakeLock, [this]() { return stopping || pending; });
+        else
+            wakeCondition.wait_for(wakeLock, HiddenDrainPeriod, [this]() { return stopping || viewVisible; });
+
+        wakeCondition.wait_until(wakeLock, nextFrame, [this]() { return stopping; });
+        if (stopping)
+            break;
+        pending = false;
+
+        wakeLock.unlock();
+
+        const auto frameStart = Clock::now();
+        dataPending = false;
+        acquireCallback();
+
+        // Cap at MaxFps; a frame over its budget backs off so that at least half of the time stays idle
+        const auto budget = std::chrono::microseconds(1000000 / std::max(maxFps.load(), 1));
+        const auto cost = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - frameStart) +
+                          std::chrono::microseconds(guiFrameCostUs.load());
+        auto interval = std::max<std::chrono::microseconds>(budget, cost * 2);
+        interval = std::min<std::chrono::microseconds>(interval, MaxFrameInterval);
+        nextFrame = frameStart + interval;
+
+        wakeLock.lock();
+    }
+}
+
+void LiveView::frameReady()
+{
+    // At most one pending render; it always takes the latest frame
+    if (frameNotified.exchange(true))
+        return;
+
+    std::lock_guard<std::mutex> timerLock(timerMutex);
+    if (frameClock && frameView)
+        QMetaObject::invokeMethod(frameClock, "requestFrame", Qt::QueuedConnection, Q_ARG(QObject*, frameView));
+    else if (frameTimer)
+        QMetaObject::invokeMethod(frameTimer, "start", Qt::QueuedConnection);
+    else
+        frameNotified = false;
+}
+
+void LiveView::attach(QWidget* widget)
+{
+    if (auto* filter = static_cast<LiveViewFilter*>(visibilityFilter.data()))
+        filter->detach();
+
+    auto* filter = new LiveViewFilter(widget, this);
+    widget->installEventFilter(filter);
+    visibilityFilter = filter;
+
+    // Not periodic: the acquisition thread starts it whenever it has a frame
+    updateTimer = new QTimer(widget);
+    updateTimer->setSingleShot(true);
+    updateTimer->setInterval(0);
+    QObject::connect(updateTimer, &QTimer::timeout, [this]() { renderFrame(); });
+    QObject::connect(updateTimer, &QObject::destroyed, [this](QObject* timer)
+    {
+        std::lock_guard<std::mutex> timerLock(timerMutex);
+        if (frameTimer == timer)
+        {
+            frameTimer = nullptr;
+            frameView = nullptr;
+        }
+    });
+
+    // The clock forgets the widget when it is destroyed
+    QObject* clock = FrameClockInterface::clock();
+    if (clock)
+        QMetaObject::invokeMethod(clock, "registerView", Qt::DirectConnection,
+                                  Q_ARG(QObject*, widget), Q_ARG(int, FrameClockInterface::Normal), Q_ARG(int, 0));
+
+    std::lock_guard<std::mutex> timerLock(timerMutex);
+    frameTimer = updateTimer;
+    frameClock = clock;
+    frameView = clock ? widget : nullptr;
+}
+
+void LiveView::renderFrame()
+{
+    frameNotified = false;
+
+    const auto frameStart = std::chrono::steady_clock::now();
+    renderCallback();
+    guiFrameCostUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frameStart).count();
+}
+
+void LiveView::setVisible(bool visible)
+{
+    if (viewVisible.exchange(visible) == visible)
+        return;
+
+    // Becoming visible needs a frame right away
+    if (visible)
+        invalidate();
+    else
+        wake();
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -1,5 +1,9 @@
 #include <opendaq_qt_module/opendaq_qt_module_impl.h>
 #include <opendaq_qt_module/qt_plotter_fb_impl.h>
+#include <opendaq_qt_module/qt_spectrum_fb_impl.h>
+#include <opendaq_qt_module/qt_waterfall_fb_impl.h>
+#include <opendaq_qt_module/qt_xy_fb_impl.h>
+#include <opendaq_qt_module/qt_statistics_fb_impl.h>
 #include <opendaq_qt_module/version.h>
 #include <coretypes/version_info_factory.h>
 #include <opendaq/custom_log.h>
@@ -23,6 +27,18 @@ daq::DictPtr<daq::IString, daq::IFunctionBlockType> OpendaqQtModule::onGetAvaila
     const auto typePlotter = QtPlotter::QtPlotterFbImpl::CreateType();
     types.set(typePlotter.getId(), typePlotter);
 
+    const auto typeSpectrum = QtPlotter::QtSpectrumFbImpl::CreateType();
+    types.set(typeSpectrum.getId(), typeSpectrum);
+
+    const auto typeWaterfall = QtPlotter::QtWaterfallFbImpl::CreateType();
+    types.set(typeWaterfall.getId(), typeWaterfall);
+
+    const auto typeXy = QtPlotter::QtXyFbImpl::CreateType();
+    types.set(typeXy.getId(), typeXy);
+
+    const auto typeStatistics = QtPlotter::QtStatisticsFbImpl::CreateType();
+    types.set(typeStatistics.getId(), typeStatistics);
+
     return types;
 }
 
@@ -38,6 +54,34 @@ daq::FunctionBlockPtr OpendaqQtModule::onCreateFunctionBlock(const daq::StringPt
         return fb;
     }
 
+    if (id == QtPlotter::QtSpectrumFbImpl::CreateType().getId())
+    {
+        daq::FunctionBlockPtr fb = daq::createWithImplementation<daq::IFunctionBlock, QtPlotter::QtSpectrumFbImpl>(
+            context, parent, localId, config);
+        return fb;
+    }
+
+    if (id == QtPlotter::QtWaterfallFbImpl::CreateType().getId())
+    {
+        daq::FunctionBlockPtr fb = daq::createWithImplementation<daq::IFunctionBlock, QtPlotter::QtWaterfallFbImpl>(
+            context, parent, localId, config);
+        return fb;
+    }
+
+    if (id == QtPlotter::QtXyFbImpl::CreateType().getId())
+    {
+        daq::FunctionBlockPtr fb = daq::createWithImplementation<daq::IFunctionBlock, QtPlotter::QtXyFbImpl>(
+            context, parent, localId, config);
+        return fb;
+    }
+
+    if (id == QtPlotter::QtStatisticsFbImpl::CreateType().getId())
+    {
+        daq::FunctionBlockPtr fb = daq::createWithImplementation<daq::IFunctionBlock, QtPlotter::QtStatisticsFbImpl>(
+            context, parent, localId, config);
+        return fb;
+    }
+
     LOG_W("Function block with id '{}' not found in OpenDAQ Qt Module", id)
     return nullptr;
 }
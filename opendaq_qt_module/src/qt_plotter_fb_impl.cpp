@@ -13,6 +13,8 @@
 #include <coreobjects/callable_info_factory.h>
 #include <coreobjects/property_object_factory.h>
 #include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_protected_ptr.h>
+#include <frame_clock_interface/frame_clock_interface.h>
 #include <QWidget>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -27,6 +29,8 @@
 #include <QtCharts/QDateTimeAxis>
 #include <QtCharts/QLegendMarker>
 #include <QDateTime>
+#include <QCoreApplication>
+#include <QDir>
 #include <QMouseEvent>
 #include <QWheelEvent>
 #include <QApplication>
@@ -34,6 +38,10 @@
 #include <QGraphicsTextItem>
 #include <QGraphicsScene>
 #include <QGraphicsLayout>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
 
 BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
 
@@ -369,6 +377,42 @@ bool ChartEventFilter::eventFilter(QObject* obj, QEvent* event)
     return QObject::eventFilter(obj, event);
 }
 
+// VisibilityEventFilter implementation
+VisibilityEventFilter::VisibilityEventFilter(QWidget* widget, QtPlotterFbImpl* plotter)
+    : QObject(widget)
+    , m_plotter(plotter)
+{}
+
+VisibilityEventFilter::~VisibilityEventFilter()
+{
+    // Destroyed together with the plot widget
+    if (m_plotter)
+        m_plotter->setPlotVisible(false);
+}
+
+void VisibilityEventFilter::detach()
+{
+    m_plotter = nullptr;
+}
+
+bool VisibilityEventFilter::eventFilter(QObject* obj, QEvent* event)
+{
+    // Our turn in a frame of the application's frame clock
+    if (m_plotter && event->type() == FrameClockInterface::FrameEvent)
+    {
+        m_plotter->updatePlot();
+        return true;
+    }
+
+    // Hidden tabs and minimised windows get (spontaneous) hide events
+    if (m_plotter && event->type() == QEvent::Show)
+        m_plotter->setPlotVisible(true);
+    else if (m_plotter && event->type() == QEvent::Hide)
+        m_plotter->setPlotVisible(false);
+
+    return QObject::eventFilter(obj, event);
+}
+
 QtPlotterFbImpl::QtPlotterFbImpl(const daq::ContextPtr& ctx,
                                  const daq::ComponentPtr& parent,
                                  const daq::StringPtr& localId,
@@ -386,6 +430,7 @@ QtPlotterFbImpl::QtPlotterFbImpl(const daq::ContextPtr& ctx,
     , downsampleMethod(QtPlotter::DownsampleMethod::LTTB)
     , maxSamplesPerSeries(10000)
     , lineStyle(QtPlotter::LineStyle::Solid)
+    , renderBackend(QtPlotter::RenderBackend::Series)
     , chart(nullptr)
     , axisX(nullptr)
     , axisY(nullptr)
@@ -393,15 +438,24 @@ QtPlotterFbImpl::QtPlotterFbImpl(const daq::ContextPtr& ctx,
     , embeddedWidget(nullptr)
     , updateTimer(nullptr)
 {
-    // Pre-allocate buffers with reasonable initial size
-    samples.resize(200);
-    timeStamps.resize(200);
-    
     initProperties();
     updateInputPorts();
     
     // Initialize widget in constructor
     initWidget();
+
+    startAcquisition();
+}
+
+QtPlotterFbImpl::~QtPlotterFbImpl()
+{
+    if (visibilityFilter)
+        visibilityFilter->detach();
+    stopAcquisition();
+
+    // Unsubscribe while the members the other plotters' wake-ups use still exist
+    signalContexts.clear();
+    HistoryGovernor::instance().unregisterClient(governorClient);
 }
 
 
@@ -471,6 +525,88 @@ void QtPlotterFbImpl::initProperties()
     const auto lineStyleProp = daq::SelectionProperty("LineStyle", List<IString>("Solid", "Dashed", "Dotted"), static_cast<Int>(lineStyle));
     objPtr.addProperty(lineStyleProp);
     objPtr.getOnPropertyValueWrite("LineStyle") += onPropertyValueWrite;
+
+    const auto rendererProp = daq::SelectionProperty("Renderer", List<IString>("Series", "Raster"), static_cast<Int>(renderBackend));
+    objPtr.addProperty(rendererProp);
+    objPtr.getOnPropertyValueWrite("Renderer") += onPropertyValueWrite;
+
+    const auto maxFpsProp = daq::IntPropertyBuilder("MaxFps", maxFps.load())
+                                .setMinValue(1)
+                                .setMaxValue(240)
+                                .setSuggestedValues(daq::List<daq::Int>(10, 30, 60, 120))
+                                .build();
+    objPtr.addProperty(maxFpsProp);
+    objPtr.getOnPropertyValueWrite("MaxFps") += onPropertyValueWrite;
+
+    // Scrollback beyond DurationHistory: evicted samples go to memory-mapped files in the temp directory
+    const auto diskBudgetProp = daq::IntPropertyBuilder("DiskBudget", diskBudgetMb)
+                                    .setMinValue(0)
+                                    .setSuggestedValues(daq::List<daq::Int>(0, 256, 1024, 4096, 16384))
+                                    .setUnit(daq::Unit("MB", -1, "megabyte", "information"))
+                                    .build();
+    objPtr.addProperty(diskBudgetProp);
+    objPtr.getOnPropertyValueWrite("DiskBudget") += onPropertyValueWrite;
+
+    // Store fixed-width min/max/first/last bins instead of raw samples; bin width follows the plot resolution
+    const auto storageDecimationProp = daq::SelectionProperty("StorageDecimation", List<IString>("Off", "Auto"), storageDecimation ? 1 : 0);
+    objPtr.addProperty(storageDecimationProp);
+    objPtr.getOnPropertyValueWrite("StorageDecimation") += onPropertyValueWrite;
+
+    // Oscilloscope mode: while following, show the capture around the latest trigger point of one signal
+    const auto triggerProp = daq::SelectionProperty("Trigger", List<IString>("Off", "Auto", "Normal", "Single"), static_cast<Int>(triggerMode));
+    objPtr.addProperty(triggerProp);
+    objPtr.getOnPropertyValueWrite("Trigger") += onPropertyValueWrite;
+
+    const auto triggerEdgeProp = daq::SelectionProperty("TriggerEdge", List<IString>("Rising", "Falling", "Level"), static_cast<Int>(triggerEdge));
+    objPtr.addProperty(triggerEdgeProp);
+    objPtr.getOnPropertyValueWrite("TriggerEdge") += onPropertyValueWrite;
+
+    const auto triggerLevelProp = daq::FloatProperty("TriggerLevel", triggerLevel);
+    objPtr.addProperty(triggerLevelProp);
+    objPtr.getOnPropertyValueWrite("TriggerLevel") += onPropertyValueWrite;
+
+    // Index of the connected signal that triggers, in the order the signals were connected
+    const auto triggerSourceProp = daq::IntPropertyBuilder("TriggerSource", triggerSource).setMinValue(0).build();
+    objPtr.addProperty(triggerSourceProp);
+    objPtr.getOnPropertyValueWrite("TriggerSource") += onPropertyValueWrite;
+
+    const auto preTriggerProp = daq::FloatPropertyBuilder("PreTrigger", preTrigger)
+                                    .setMinValue(0.0)
+                                    .setUnit(daq::Unit("s", -1, "second", "time"))
+                                    .build();
+    objPtr.addProperty(preTriggerProp);
+    objPtr.getOnPropertyValueWrite("PreTrigger") += onPropertyValueWrite;
+
+    const auto postTriggerProp = daq::FloatPropertyBuilder("PostTrigger", postTrigger)
+                                     .setMinValue(0.0)
+                                     .setUnit(daq::Unit("s", -1, "second", "time"))
+                                     .build();
+    objPtr.addProperty(postTriggerProp);
+    objPtr.getOnPropertyValueWrite("PostTrigger") += onPropertyValueWrite;
+
+    // Statistic: average time the acquisition thread spends reading and downsampling per frame
+    const auto frameTimeProp = daq::FloatPropertyBuilder("FrameTime", 0.0)
+                                   .setReadOnly(true)
+                                   .setUnit(daq::Unit("ms", -1, "millisecond", "time"))
+                                   .build();
+    objPtr.addProperty(frameTimeProp);
+
+    // History memory of all plotters of the process, 0 = unlimited. One value: writing it on any plotter
+    // shows on all of them. Over budget, the least recently viewed plotters store decimated bins, then keep shorter history.
+    const auto historyBudgetProp = daq::IntPropertyBuilder("HistoryBudget", shownBudgetMb.load())
+                                       .setMinValue(0)
+                                       .setSuggestedValues(daq::List<daq::Int>(0, 512, 1024, 2048, 4096, 8192))
+                                       .setUnit(daq::Unit("MB", -1, "megabyte", "information"))
+                                       .build();
+    objPtr.addProperty(historyBudgetProp);
+    objPtr.getOnPropertyValueWrite("HistoryBudget") += onPropertyValueWrite;
+
+    // Statistic: history memory this plotter accounts for; histories shared with other plotters count in equal parts
+    const auto historyBytesProp = daq::IntPropertyBuilder("HistoryBytes", 0)
+                                      .setReadOnly(true)
+                                      .setUnit(daq::Unit("B", -1, "byte", "information"))
+                                      .build();
+    objPtr.addProperty(historyBytesProp);
 }
 
 void QtPlotterFbImpl::propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value)
@@ -480,7 +616,10 @@ void QtPlotterFbImpl::propertyChanged(const StringPtr& propertyName, const BaseO
     if (propertyName == "Duration")
         duration = value;
     else if (propertyName == "DurationHistory")
+    {
         durationHistory = value;
+        historyStale = true;
+    }
     else if (propertyName == "ShowLegend")
     {
         showLegend = value;
@@ -512,6 +651,47 @@ void QtPlotterFbImpl::propertyChanged(const StringPtr& propertyName, const BaseO
         lineStyle = static_cast<QtPlotter::LineStyle>(value.asPtr<IInteger>(true));
         updateSeriesLineStyle();
     }
+    else if (propertyName == "Renderer")
+        renderBackend = static_cast<QtPlotter::RenderBackend>(value.asPtr<IInteger>(true));
+    else if (propertyName == "MaxFps")
+        maxFps = static_cast<Int>(value);
+    else if (propertyName == "DiskBudget")
+    {
+        diskBudgetMb = value;
+        spillStale = true;
+    }
+    else if (propertyName == "StorageDecimation")
+        storageDecimation = static_cast<Int>(value) != 0;
+    else if (propertyName == "Trigger" || propertyName == "TriggerEdge" || propertyName == "TriggerLevel" ||
+             propertyName == "TriggerSource" || propertyName == "PreTrigger" || propertyName == "PostTrigger")
+    {
+        if (propertyName == "Trigger")
+            triggerMode = static_cast<TriggerMode>(value.asPtr<IInteger>(true));
+        else if (propertyName == "TriggerEdge")
+            triggerEdge = static_cast<TriggerEdge>(value.asPtr<IInteger>(true));
+        else if (propertyName == "TriggerLevel")
+            triggerLevel = value;
+        else if (propertyName == "TriggerSource")
+            triggerSource = value;
+        else if (propertyName == "PreTrigger")
+            preTrigger = value;
+        else
+            postTrigger = value;
+
+        // Writing any trigger setting re-arms, which also restarts Single
+        rearmPending = true;
+        historyStale = true;
+    }
+    else if (propertyName == "HistoryBudget")
+    {
+        // A value governHistory shows from another plotter's write is not written back
+        const Int budgetMb = value;
+        if (shownBudgetMb.exchange(budgetMb) != budgetMb)
+            HistoryGovernor::instance().setBudget(static_cast<size_t>(std::max<Int>(budgetMb, 0)) << 20);
+    }
+
+    framesDirty = true;
+    wakeAcquisition();
 
     LOG_W("Property {} changed to {}", propertyName, value.toString());
 }
@@ -521,10 +701,33 @@ void QtPlotterFbImpl::updateInputPorts()
     const auto inputPort = createAndAddInputPort(
         fmt::format("Input{}", inputPortCount++),
         daq::PacketReadyNotification::SameThread);
-    auto [it, _] = signalContexts.emplace(inputPort, inputPort);
+    auto [it, _] = signalContexts.try_emplace(inputPort, inputPort, nextSignalId++);
     it->second.streamReader.setExternalListener(this->template borrowPtr<InputPortNotificationsPtr>());
 }
 
+AcquisitionSettings QtPlotterFbImpl::acquisitionSettings() const
+{
+    AcquisitionSettings result;
+    result.duration = duration;
+    result.durationHistory = durationHistory;
+    result.autoScale = autoScale;
+    result.autoClear = autoClear;
+    result.defaultMinY = defaultMinY;
+    result.defaultMaxY = defaultMaxY;
+    result.downsampleMethod = downsampleMethod;
+    result.maxSamplesPerSeries = maxSamplesPerSeries;
+    result.renderBackend = renderBackend;
+    result.diskBudgetMb = diskBudgetMb;
+    result.storageDecimation = storageDecimation;
+    result.triggerMode = triggerMode;
+    result.triggerEdge = triggerEdge;
+    result.triggerLevel = triggerLevel;
+    result.triggerSource = triggerSource;
+    result.preTrigger = preTrigger;
+    result.postTrigger = postTrigger;
+    return result;
+}
+
 void QtPlotterFbImpl::onConnected(const daq::InputPortPtr& inputPort)
 {
     auto signal = inputPort.getSignal();
@@ -533,26 +736,21 @@ void QtPlotterFbImpl::onConnected(const daq::InputPortPtr& inputPort)
 
     auto lock = this->getRecursiveConfigLock();
 
+    // A new port only for a port connected the first time, not for a replaced signal
     auto it = signalContexts.find(inputPort);
     bool createNewPort = true;
     if (it != signalContexts.end())
     {
-        if (it->second.isSignalConnected)
-        {
-            createNewPort = false;
-
-            if (autoClear)
-            {
-                if (it->second.series)
-                    it->second.series->clear();
-                it->second.pointsBuffer.clear();
-            }
-        }
+        createNewPort = !it->second.isSignalConnected;
         it->second.isSignalConnected = true;
     }
 
+    // The history switches over with the next frame, the acquisition thread may be reading it
+    portChanges.emplace_back(inputPort, signal);
     if (createNewPort)
         updateInputPorts();
+    framesDirty = true;
+    wakeAcquisition();
 
     LOG_W("Connected to port {}", inputPort.getLocalId());
 }
@@ -561,22 +759,25 @@ void QtPlotterFbImpl::onDisconnected(const daq::InputPortPtr& inputPort)
 {
     auto lock = this->getRecursiveConfigLock();
 
+    // The signal context is removed with the next frame; the series is removed by the GUI
+    // thread once the signal is missing from a published frame
     if (auto it = signalContexts.find(inputPort); it != signalContexts.end())
-    {
-        if (autoClear && chart && it->second.series)
-        {
-            chart->removeSeries(it->second.series);
-            it->second.series->deleteLater();
-            LOG_W("Removed series '{}' for disconnected port {}",
-                  it->second.caption, inputPort.getLocalId());
-        }
-        signalContexts.erase(it);
-    }
+        it->second.isSignalConnected = false;
+    portChanges.emplace_back(inputPort, nullptr);
+    framesDirty = true;
+    wakeAcquisition();
 
     removeInputPort(inputPort);
     LOG_W("Disconnected from port {}", inputPort.getLocalId());
 }
 
+void QtPlotterFbImpl::onPacketReceived(const daq::InputPortPtr& /*port*/)
+{
+    // Called for every packet; one wake-up covers everything queued until the next frame
+    if (!dataPending.exchange(true))
+        wakeAcquisition();
+}
+
 Qt::PenStyle QtPlotterFbImpl::getQtPenStyle() const
 {
     switch (lineStyle)
@@ -595,24 +796,24 @@ void QtPlotterFbImpl::updateSeriesLineStyle()
 {
     Qt::PenStyle penStyle = getQtPenStyle();
 
-    for (auto& [port, sigCtx] : signalContexts)
+    for (auto& [id, series] : seriesById)
     {
-        if (sigCtx.series)
+        if (series)
         {
-            QPen pen = sigCtx.series->pen();
+            QPen pen = series->pen();
             pen.setStyle(penStyle);
-            sigCtx.series->setPen(pen);
+            series->setPen(pen);
         }
     }
 }
 
-void QtPlotterFbImpl::createSeriesForSignal(SignalContext& sigCtx)
+QLineSeries* QtPlotterFbImpl::createSeriesForSignal(const SignalFrame& signalFrame)
 {
     if (!chart || !axisX || !axisY)
-        return;
+        return nullptr;
 
-    sigCtx.series = new QLineSeries();
-    sigCtx.series->setName(QString::fromStdString(sigCtx.caption));
+    auto* series = new QLineSeries();
+    series->setName(QString::fromStdString(signalFrame.caption));
 
     // Colors for different signals
     static const QColor colors[] = {
@@ -624,11 +825,20 @@ void QtPlotterFbImpl::createSeriesForSignal(SignalContext& sigCtx)
         QColor(0, 0, 255)       // Blue
     };
     QPen pen(colors[(seriesIndex++) % 6], 2, getQtPenStyle());
-    sigCtx.series->setPen(pen);
+    series->setPen(pen);
+
+    chart->addSeries(series);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    return series;
+}
 
-    chart->addSeries(sigCtx.series);
-    sigCtx.series->attachAxis(axisX);
-    sigCtx.series->attachAxis(axisY);
+QLineSeries* QtPlotterFbImpl::seriesForSignal(const SignalContext& sigCtx) const
+{
+    auto it = seriesById.find(sigCtx.id);
+    if (it == seriesById.end())
+        return nullptr;
+    return it->second;
 }
 
 void QtPlotterFbImpl::handleEventPacket(SignalContext& sigCtx, const daq::EventPacketPtr& eventPacket)
@@ -642,6 +852,8 @@ void QtPlotterFbImpl::handleEventPacket(SignalContext& sigCtx, const daq::EventP
     else
         sigCtx.caption = "N/A";
 
+    framesDirty = true;
+
     const DataDescriptorPtr descriptor = eventPacket.getParameters()[event_packet_param::DATA_DESCRIPTOR];
     if (descriptor.assigned())
     {
@@ -657,170 +869,827 @@ void QtPlotterFbImpl::handleEventPacket(SignalContext& sigCtx, const daq::EventP
             sigCtx.valueRangeMax = valueRange.getHighValue();
         }
     }
+
+    // Sample rate of a linear domain sizes the history store up front; the history
+    // applies the descriptor's read types and tick mapping itself
+    const DataDescriptorPtr domainDescriptor = eventPacket.getParameters()[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
+    if (domainDescriptor.assigned())
+    {
+        sigCtx.sampleRate = 0.0;
+        auto rule = domainDescriptor.getRule();
+        auto tickResolution = domainDescriptor.getTickResolution();
+        double secondsPerTick = 0.0;
+        if (tickResolution.assigned())
+            secondsPerTick = static_cast<double>(tickResolution.getNumerator()) /
+                             static_cast<double>(tickResolution.getDenominator());
+
+        if (rule.assigned() && rule.getType() == DataRuleType::Linear)
+        {
+            const double delta = rule.getParameters().get("delta");
+            if (delta > 0.0 && secondsPerTick > 0.0)
+                sigCtx.sampleRate = 1.0 / (delta * secondsPerTick);
+        }
+        reserveHistory(sigCtx);
+    }
 }
 
-bool QtPlotterFbImpl::handleData(SignalContext& sigCtx, QLineSeries* series, size_t count, qint64& outLatestTime)
+void QtPlotterFbImpl::configureSpill()
 {
-    if (!series)
-        return false;
+    for (auto& [port, sigCtx] : signalContexts)
+        configureSpill(sigCtx);
+}
 
-    outLatestTime = 0;
+void QtPlotterFbImpl::configureSpill(SignalContext& sigCtx) const
+{
+    // The budget is shared evenly by the connected signals
+    const auto connectedCount = std::count_if(signalContexts.begin(), signalContexts.end(),
+                                              [](const auto& entry) { return entry.second.isSignalConnected; });
 
-    // Sync buffer with series - but optimize: only copy if buffer is empty
-    // After first sync, buffer is maintained separately and series is updated from buffer
-    int currentPointCount = series->count();
-    if (sigCtx.pointsBuffer.isEmpty() && currentPointCount > 0)
+    SpillConfig config;
+    if (settings.diskBudgetMb > 0 && sigCtx.isSignalConnected)
     {
-        // Initial sync: copy from series to buffer
-        const auto& existingPoints = series->points();
-        sigCtx.pointsBuffer = existingPoints;
+        config.budgetBytes = settings.diskBudgetMb * 1024 * 1024 / std::max<Int>(connectedCount, 1);
+        config.directory = QDir(QDir::tempPath())
+                               .filePath(QString("opendaq_qt_plotter/%1_%2_%3")
+                                             .arg(QCoreApplication::applicationPid())
+                                             .arg(reinterpret_cast<quintptr>(this), 0, 16)
+                                             .arg(sigCtx.id));
     }
+    sigCtx.history->setSpill(sigCtx.subscriber, config);
+}
 
-    // Trim old points by time (keep only durationHistory seconds)
-    if (!sigCtx.pointsBuffer.isEmpty())
-    {
-        auto timeMsec = std::chrono::duration_cast<std::chrono::milliseconds>(timeStamps[count - 1].time_since_epoch()).count();
-        qint64 latestTime = static_cast<qint64>(timeMsec);
-        qint64 historyMsec = static_cast<qint64>(durationHistory * 1000);
-        qint64 minTimeToKeep = latestTime - historyMsec;
+void QtPlotterFbImpl::reserveHistory(SignalContext& sigCtx) const
+{
+    sigCtx.history->setHistory(sigCtx.subscriber, effectiveHistory(), sigCtx.sampleRate);
+}
+
+double QtPlotterFbImpl::effectiveHistory() const
+{
+    // Level 1 only decimates; every level beyond halves the history
+    double history = settings.durationHistory;
+    if (historyLevel >= 2)
+        history = std::max(settings.duration, settings.durationHistory / static_cast<double>(1 << (historyLevel - 1)));
+
+    // A capture has to fit
+    if (settings.triggerMode != TriggerMode::Off)
+        history = std::max(history, settings.preTrigger + settings.postTrigger);
+    return history;
+}
 
-        // Use binary search to find first point >= minTimeToKeep
-        if (minTimeToKeep > 0)
+int QtPlotterFbImpl::maxHistoryLevel() const
+{
+    int level = 1;
+    for (double history = settings.durationHistory / 2.0; history >= settings.duration && level < 30; history /= 2.0)
+        ++level;
+    return level;
+}
+
+void QtPlotterFbImpl::configureDecimation(SignalContext& sigCtx, qreal pixelWidth) const
+{
+    constexpr size_t MinDecimationBin = 8;
+
+    // StorageDecimation, or the history governor asks for it to save memory
+    const bool decimate = settings.storageDecimation || historyLevel >= 1;
+
+    // Plot not laid out yet: keep the current bins
+    if (decimate && pixelWidth <= 0.0)
+        return;
+
+    // Two bins per pixel of the Duration window; rounded down to a power of two so
+    // small resizes keep the bin width. Folding pays off only for wide bins.
+    size_t binSize = 0;
+    if (decimate && sigCtx.sampleRate > 0.0)
+    {
+        const double samplesPerBin = sigCtx.sampleRate * settings.duration / (pixelWidth * 2.0);
+        if (samplesPerBin >= static_cast<double>(MinDecimationBin))
         {
-            int firstValidIdx = binarySearchFirstGE(sigCtx.pointsBuffer, minTimeToKeep);
-            if (firstValidIdx > 0)
-                sigCtx.pointsBuffer.remove(0, firstValidIdx);
+            binSize = MinDecimationBin;
+            while (static_cast<double>(binSize * 2) <= samplesPerBin)
+                binSize *= 2;
         }
     }
+    sigCtx.history->setStorageDecimation(sigCtx.subscriber, binSize);
+}
+
+bool QtPlotterFbImpl::handleData(SignalContext& sigCtx, qint64& outLatestTime)
+{
+    outLatestTime = 0;
+
+    // The history keeps the longest DurationHistory of all plotters sharing it, trimmed as it stores
+    if (sigCtx.history->isEmpty(sigCtx.subscriber))
+        return false;
+
+    // Update time range for fast visible range check
+    sigCtx.dataMinTime = static_cast<qint64>(sigCtx.history->firstTime(sigCtx.subscriber));
+    sigCtx.dataMaxTime = static_cast<qint64>(sigCtx.history->lastTime());
+    outLatestTime = sigCtx.dataMaxTime;
+
+    return true;
+}
 
-    // Add all new points to history buffer (pointsBuffer stores full duration history)
-    // No downsampling here - we'll downsample only visible points later
-    for (size_t i = 0; i < count; ++i)
+void QtPlotterFbImpl::startAcquisition()
+{
+    acquisitionThread = std::thread(&QtPlotterFbImpl::acquisitionLoop, this);
+}
+
+void QtPlotterFbImpl::stopAcquisition()
+{
     {
-        auto timeMsec = std::chrono::duration_cast<std::chrono::milliseconds>(timeStamps[i].time_since_epoch()).count();
-        sigCtx.pointsBuffer.append(QPointF(timeMsec, samples[i]));
+        std::lock_guard<std::mutex> wakeLock(acquisitionMutex);
+        acquisitionStopping = true;
     }
+    acquisitionWake.notify_one();
 
-    // Update time range for fast visible range check
-    if (!sigCtx.pointsBuffer.isEmpty())
+    if (acquisitionThread.joinable())
+        acquisitionThread.join();
+}
+
+void QtPlotterFbImpl::wakeAcquisition()
+{
     {
-        sigCtx.dataMinTime = static_cast<qint64>(sigCtx.pointsBuffer.first().x());
-        sigCtx.dataMaxTime = static_cast<qint64>(sigCtx.pointsBuffer.last().x());
-        outLatestTime = sigCtx.dataMaxTime;
+        std::lock_guard<std::mutex> wakeLock(acquisitionMutex);
+        acquisitionPending = true;
     }
+    acquisitionWake.notify_one();
+}
 
-    return true;
+void QtPlotterFbImpl::acquisitionLoop()
+{
+    using Clock = std::chrono::steady_clock;
+
+    // While hidden, readers are still drained so their queues do not grow, but rarely
+    constexpr auto HiddenDrainPeriod = std::chrono::milliseconds(500);
+    // Slowest frame rate backing off can reach
+    constexpr auto MaxFrameInterval = std::chrono::milliseconds(1000);
+
+    Clock::time_point nextFrame = Clock::now();
+
+    std::unique_lock<std::mutex> wakeLock(acquisitionMutex);
+    while (!acquisitionStopping)
+    {
+        // Sleep until packets arrive or the view or settings change
+        if (plotVisible)
+            acquisitionWake.wait(wakeLock, [this]() { return acquisitionStopping || acquisitionPending; });
+        else
+            acquisitionWake.wait_for(wakeLock, HiddenDrainPeriod, [this]() { return acquisitionStopping || plotVisible; });
+
+        // Frame pacing: no earlier than the previous frame's interval allows
+        acquisitionWake.wait_until(wakeLock, nextFrame, [this]() { return acquisitionStopping; });
+        if (acquisitionStopping)
+            break;
+        acquisitionPending = false;
+
+        wakeLock.unlock();
+
+        const auto frameStart = Clock::now();
+        dataPending = false;
+        acquire();
+
+        // Cap at MaxFps; if a frame (acquisition plus GUI update) took longer than its budget,
+        // back off so that at least half of the time stays idle
+        const auto budget = std::chrono::microseconds(1000000 / std::max<Int>(maxFps.load(), 1));
+        const auto cost = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - frameStart) +
+                          std::chrono::microseconds(guiFrameCostUs.load());
+        auto interval = std::max<std::chrono::microseconds>(budget, cost * 2);
+        interval = std::min<std::chrono::microseconds>(interval, MaxFrameInterval);
+        nextFrame = frameStart + interval;
+
+        wakeLock.lock();
+    }
 }
 
-void QtPlotterFbImpl::updatePlot()
+void QtPlotterFbImpl::notifyFrameReady()
 {
-    auto lock = getRecursiveConfigLock();
-    
-    // Update plot if chart exists and embeddedWidget is available
-    if (!chart || !embeddedWidget)
+    // At most one pending updatePlot; it always takes the latest frame
+    if (frameNotified.exchange(true))
         return;
 
+    // Batched with the other live views by the frame clock if the application has one
+    std::lock_guard<std::mutex> timerLock(frameTimerMutex);
+    if (frameClock && frameView)
+        QMetaObject::invokeMethod(frameClock, "requestFrame", Qt::QueuedConnection, Q_ARG(QObject*, frameView));
+    else if (frameTimer)
+        QMetaObject::invokeMethod(frameTimer, "start", Qt::QueuedConnection);
+    else
+        frameNotified = false;
+}
+
+void QtPlotterFbImpl::acquire()
+{
+    viewBuffer.update();
+    const PlotView& view = viewBuffer.readBuffer();
+    const bool clear = clearRequested.exchange(false);
+    const auto frameStart = std::chrono::steady_clock::now();
+
+    // Only the settings and the signals of the frame are taken under the config lock; GUI
+    // and property writes do not wait for the reads and the downsampling below
+    {
+        auto lock = getRecursiveConfigLock();
+        settings = acquisitionSettings();
+        applyConfigChanges();
+
+        activeSignals.clear();
+        for (auto& [port, sigCtx] : signalContexts)
+        {
+            // Clear history as well, otherwise the next frame repopulates the series
+            if (clear)
+                sigCtx.history->clear(sigCtx.subscriber);
+
+            if (sigCtx.isSignalConnected)
+            {
+                configureDecimation(sigCtx, view.pixelWidth);
+                activeSignals.push_back(&sigCtx);
+            }
+        }
+    }
+
+    const bool dirty = framesDirty || clear;
+    const bool newRange = view.generation != renderedViewGeneration;
+    bool changed = dirty || newRange;
     qint64 globalLatestTime = 0;
     bool hasData = false;
 
-    for (auto& [port, sigCtx] : signalContexts)
+    // Signals are independent: read and trim them in parallel
+    workerPool->parallelFor(activeSignals.size(), [this](size_t i) { readSignal(*activeSignals[i]); });
+    governHistory();
+
+    // Triggered: while following, a frame shows the latest capture and is built once per capture
+    const bool triggered = settings.triggerMode != TriggerMode::Off && view.followLatest;
+    const bool newCapture = settings.triggerMode != TriggerMode::Off && updateTrigger();
+
+    for (const SignalContext* sigCtx : activeSignals)
     {
-        if (!sigCtx.isSignalConnected)
-            continue;
+        if (!triggered && (sigCtx->newData || !sigCtx->pointsRefined))
+            changed = true;
+
+        if (!sigCtx->history->isEmpty(sigCtx->subscriber))
+        {
+            if (sigCtx->dataMaxTime > globalLatestTime)
+                globalLatestTime = sigCtx->dataMaxTime;
+            hasData = true;
+        }
+    }
+
+    if (triggered)
+        changed = (changed || newCapture) && !std::isnan(captureTime);
+
+    // Nothing new to draw, keep the GUI on the frame it has
+    if (!changed)
+        return;
+
+    // Not on screen: keep history up to date, build the frame once it is shown again
+    if (!plotVisible)
+    {
+        framesDirty = true;
+        return;
+    }
+
+    framesDirty = false;
+    renderedViewGeneration = view.generation;
+
+    PlotFrame& frame = frameBuffer.writeBuffer();
+    frame.hasData = hasData;
+    frame.followLatest = view.followLatest;
+    if (triggered)
+    {
+        frame.visibleMin = captureTime - settings.preTrigger * 1000.0;
+        frame.visibleMax = captureTime + settings.postTrigger * 1000.0;
+    }
+    else if (view.followLatest)
+    {
+        // Auto-follow mode: show last 'duration' seconds
+        frame.visibleMax = static_cast<double>(globalLatestTime);
+        frame.visibleMin = frame.visibleMax - settings.duration * 1000.0;
+    }
+    else
+    {
+        frame.visibleMin = view.visibleMin;
+        frame.visibleMax = view.visibleMax;
+    }
+
+    VisibleRequest request;
+    request.visibleMin = frame.visibleMin;
+    request.visibleMax = frame.visibleMax;
+    request.method = settings.downsampleMethod;
+    request.maxSamples = settings.maxSamplesPerSeries;
+    request.pixelWidth = view.pixelWidth;
+    request.followLatest = view.followLatest && !triggered;
+
+    // First frame of a new range: min/max envelope at about two points per pixel, drawn
+    // from the pyramid summaries, so its cost follows the plot width
+    VisibleRequest coarseRequest = request;
+    coarseRequest.method = DownsampleMethod::MinMax;
+    coarseRequest.maxSamples = std::min(settings.maxSamplesPerSeries, static_cast<size_t>(std::max<qreal>(view.pixelWidth, 50.0) * 2.0));
+    coarseRequest.followLatest = false;
+
+    // Signals keep their points while nothing that affects them changed. A new range
+    // (zoom/pan) starts over with coarse points; auto-follow frames are always full detail.
+    const quint64 allocationsBefore = FrameAllocations::count();
+    frame.signalFrames.resize(activeSignals.size());
+    workerPool->parallelFor(activeSignals.size(), [this, &frame, &request, &coarseRequest, &view, newRange, dirty, triggered](size_t i)
+    {
+        SignalContext& sigCtx = *activeSignals[i];
+        if (triggered || newRange || dirty || sigCtx.newData || view.followLatest)
+        {
+            if (view.followLatest)
+                sigCtx.pointsRefined = true;
+            else if (newRange)
+                sigCtx.pointsRefined = false;
+            buildSignalPoints(sigCtx, sigCtx.pointsRefined ? request : coarseRequest);
+        }
+        fillSignalFrame(sigCtx, frame.signalFrames[i]);
+    });
 
-        // Get or create series for this signal (direct pointer access - O(1))
-        if (!sigCtx.series)
-            createSeriesForSignal(sigCtx);
+    // Refine coarse signals in slices while the range stays; the frame with the coarse
+    // points has been shown already. A new range cancels the rest of the slice.
+    if (!newRange)
+        refineSignals(frame, request, view.generation);
 
-        QLineSeries* series = sigCtx.series;
+    // Buffers have grown to the view by now; only view changes may reallocate them
+    if (!newRange && !dirty)
+        steadyFrameAllocations += FrameAllocations::count() - allocationsBefore;
+
+    // Auto-scale Y-axis if enabled
+    frame.autoScale = settings.autoScale;
+    if (settings.autoScale)
+    {
+        double minY = std::numeric_limits<double>::max();
+        double maxY = std::numeric_limits<double>::lowest();
 
-        // Extract and plot data using TimeReader
-        if (sigCtx.timeReader.assigned())
+        // Use value range from descriptor if available, otherwise use default
+        for (const SignalContext* sigCtx : activeSignals)
         {
-            try
+            if (sigCtx->valueRangeMin < sigCtx->valueRangeMax)
             {
-                size_t count = sigCtx.timeReader.getAvailableCount();
-                if (count > samples.size())
-                {
-                    samples.resize(count);
-                    timeStamps.resize(count);
-                }
-                
-                daq::ReaderStatusPtr status;
-                sigCtx.timeReader.readWithDomain(samples.data(), timeStamps.data(), &count, 0, &status);
-                if (status.assigned())
-                {
-                    auto eventPacket = status.getEventPacket();
-                    if (eventPacket.assigned())
-                        handleEventPacket(sigCtx, eventPacket);
-                }
-                
-                if (count > 0)
-                {
-                    qint64 latestTime = 0;
-                    if (handleData(sigCtx, series, count, latestTime))
-                    {
-                        if (latestTime > globalLatestTime)
-                            globalLatestTime = latestTime;
-                        hasData = true;
-                        
-                        // Update visible series immediately when adding new data
-                        // (debouncing only applies to zoom/pan operations)
-                        if (axisX)
-                        {
-                            qint64 visibleMin = axisX->min().toMSecsSinceEpoch();
-                            qint64 visibleMax = axisX->max().toMSecsSinceEpoch();
-                            updateVisibleSeries(sigCtx, series, visibleMin, visibleMax);
-                        }
-                    }
-                }
+                // Use range from descriptor
+                if (sigCtx->valueRangeMin < minY)
+                    minY = sigCtx->valueRangeMin;
+                if (sigCtx->valueRangeMax > maxY)
+                    maxY = sigCtx->valueRangeMax;
             }
-            catch (const std::exception& e)
+        }
+
+        // Fall back to default range if no valid ranges from descriptors
+        if (minY >= maxY)
+        {
+            minY = settings.defaultMinY;
+            maxY = settings.defaultMaxY;
+        }
+
+        frame.valueMin = minY;
+        frame.valueMax = maxY;
+    }
+
+    frame.removeDisconnectedSeries = settings.autoClear;
+    frame.rasterRenderer = settings.renderBackend == RenderBackend::Raster;
+
+    frameBuffer.publish();
+    notifyFrameReady();
+
+    reportFrameTime(std::chrono::steady_clock::now() - frameStart);
+
+    // Continue refining on the next frame slot
+    if (std::any_of(activeSignals.begin(), activeSignals.end(), [](const SignalContext* sigCtx) { return !sigCtx->pointsRefined; }))
+        wakeAcquisition();
+}
+
+void QtPlotterFbImpl::applyConfigChanges()
+{
+    for (const auto& [port, signal] : portChanges)
+    {
+        auto it = signalContexts.find(port);
+        if (it == signalContexts.end())
+            continue;
+
+        if (!signal.assigned())
+        {
+            signalContexts.erase(it);
+            continue;
+        }
+
+        // Plotters showing the same signal read and keep its history once; whichever of
+        // them reads wakes the others
+        SignalContext& sigCtx = it->second;
+        const bool replaced = !sigCtx.signalId.empty();
+        sigCtx.history->unsubscribe(sigCtx.subscriber);
+        sigCtx.history = HistoryCache::instance().subscribe(signal, sigCtx.subscriber, [this]()
+        {
+            if (!dataPending.exchange(true))
+                wakeAcquisition();
+        });
+        sigCtx.signalId = signal.getGlobalId().toStdString();
+        sigCtx.historyVersion = sigCtx.history->version();
+        reserveHistory(sigCtx);
+
+        // A replaced signal starts over, without what other plotters keep of the new one
+        if (replaced && settings.autoClear)
+            sigCtx.history->clear(sigCtx.subscriber);
+    }
+    if (!portChanges.empty())
+        spillStale = true;
+    portChanges.clear();
+
+    if (rearmPending)
+        rearmTrigger();
+    if (historyStale)
+    {
+        for (auto& [port, sigCtx] : signalContexts)
+            reserveHistory(sigCtx);
+    }
+    if (spillStale)
+        configureSpill();
+    rearmPending = false;
+    historyStale = false;
+    spillStale = false;
+}
+
+void QtPlotterFbImpl::buildSignalPoints(SignalContext& sigCtx, const VisibleRequest& request) const
+{
+    // Points and the scratch of this pool thread are rebuilt in their existing capacity
+    auto& scratch = KernelScratch::local();
+    FrameAllocations::Watch pointsWatch(sigCtx.points);
+    FrameAllocations::Watch envelopeWatch(scratch.envelope);
+    FrameAllocations::Watch valuesWatch(scratch.values);
+    FrameAllocations::Watch timesWatch(scratch.times);
+
+    sigCtx.points.resize(0);
+    if (!sigCtx.history->isEmpty(sigCtx.subscriber))
+        sigCtx.history->visiblePoints(sigCtx.subscriber, request, sigCtx.points);
+}
+
+void QtPlotterFbImpl::fillSignalFrame(const SignalContext& sigCtx, SignalFrame& signalFrame) const
+{
+    signalFrame.signalId = sigCtx.id;
+    signalFrame.caption = sigCtx.caption;
+    signalFrame.hasData = !sigCtx.history->isEmpty(sigCtx.subscriber);
+    signalFrame.dataMinTime = sigCtx.dataMinTime;
+    signalFrame.dataMaxTime = sigCtx.dataMaxTime;
+    signalFrame.history = sigCtx.history;
+    signalFrame.subscriber = sigCtx.subscriber;
+
+    // Copied into the slot's own buffer: sharing would make the next rebuild of
+    // sigCtx.points detach. The chart lets go of a slot's points when it takes the next frame.
+    FrameAllocations::Watch pointsWatch(signalFrame.points);
+    signalFrame.points.resize(sigCtx.points.size());
+    std::copy(sigCtx.points.cbegin(), sigCtx.points.cend(), signalFrame.points.begin());
+}
+
+void QtPlotterFbImpl::refineSignals(PlotFrame& frame, const VisibleRequest& request, quint64 viewGeneration)
+{
+    // Half a frame interval per slice leaves the rest to reading and the GUI
+    const auto sliceEnd = std::chrono::steady_clock::now() +
+                          std::chrono::microseconds(500000 / std::max<Int>(maxFps.load(), 1));
+
+    auto& pending = refinePending;
+    pending.clear();
+    for (size_t i = 0; i < activeSignals.size(); ++i)
+        if (!activeSignals[i]->pointsRefined)
+            pending.push_back(i);
+
+    // A batch keeps every pool thread busy with one signal; the budget is checked between batches
+    size_t next = 0;
+    while (next < pending.size() && std::chrono::steady_clock::now() < sliceEnd &&
+           publishedViewGeneration.load() == viewGeneration)
+    {
+        const size_t batch = std::min(pending.size() - next, workerPool->concurrency());
+        workerPool->parallelFor(batch, [this, &frame, &request, &pending, next](size_t i)
+        {
+            const size_t index = pending[next + i];
+            SignalContext& sigCtx = *activeSignals[index];
+            buildSignalPoints(sigCtx, request);
+            sigCtx.pointsRefined = true;
+            fillSignalFrame(sigCtx, frame.signalFrames[index]);
+        });
+        next += batch;
+    }
+}
+
+void QtPlotterFbImpl::readSignal(SignalContext& sigCtx)
+{
+    // The port's own queue is only drained, for the descriptor events the plotter shows;
+    // skipping drops whole packets without converting their samples
+    try
+    {
+        daq::ReaderStatusPtr status;
+        daq::SizeT count = sigCtx.streamReader.getAvailableCount();
+        sigCtx.streamReader.skipSamples(&count, &status);
+        if (status.assigned())
+        {
+            auto eventPacket = status.getEventPacket();
+            if (eventPacket.assigned())
+                handleEventPacket(sigCtx, eventPacket);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Error draining StreamReader: {}", e.what())
+    }
+
+    // Samples are read once for every plotter showing the signal, by whichever gets here first
+    try
+    {
+        sigCtx.history->read(sigCtx.subscriber);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Error reading data from StreamReader: {}", e.what())
+    }
+
+    const quint64 version = sigCtx.history->version();
+    sigCtx.newData = version != sigCtx.historyVersion;
+    sigCtx.historyVersion = version;
+
+    qint64 latestTime = 0;
+    handleData(sigCtx, latestTime);
+
+    const std::string spillError = sigCtx.history->takeSpillError(sigCtx.subscriber);
+    if (!spillError.empty())
+        LOG_W("Disk history disabled for {}: {}", sigCtx.caption, spillError)
+}
+
+void QtPlotterFbImpl::reportFrameTime(std::chrono::steady_clock::duration frameTime)
+{
+    // Published about once a second; a property write per frame would flood its listeners
+    constexpr auto ReportPeriod = std::chrono::seconds(1);
+
+    frameTimeSum += frameTime;
+    ++frameTimeCount;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - frameTimeReported < ReportPeriod)
+        return;
+
+    const double averageMs = std::chrono::duration<double, std::milli>(frameTimeSum).count() / frameTimeCount;
+    frameTimeSum = {};
+    frameTimeCount = 0;
+    frameTimeReported = now;
+
+    objPtr.asPtr<IPropertyObjectProtected>().setProtectedPropertyValue("FrameTime", averageMs);
+
+#ifndef NDEBUG
+    // Counted across all plotters of the process, attributed to whoever reports
+    if (steadyFrameAllocations > 0)
+        LOG_D("{} frame buffer reallocations in frames without view changes", steadyFrameAllocations)
+    steadyFrameAllocations = 0;
+#endif
+}
+
+void QtPlotterFbImpl::governHistory()
+{
+    constexpr auto ReportPeriod = std::chrono::seconds(1);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (plotVisible)
+        lastViewed = now;
+    if (now - historyReported < ReportPeriod)
+        return;
+    historyReported = now;
+
+    // Committed bytes already count shrinks that wait for old samples to age out,
+    // so the governor does not degrade further while a previous step takes effect
+    HistoryGovernor::Report report;
+    size_t bytes = 0;
+    for (const SignalContext* sigCtx : activeSignals)
+    {
+        const auto share = sigCtx->history->memoryShare();
+        bytes += share.bytes;
+        report.bytes += share.committedBytes;
+    }
+    report.lastViewed = lastViewed;
+    report.maxLevel = maxHistoryLevel();
+
+    objPtr.asPtr<IPropertyObjectProtected>().setProtectedPropertyValue("HistoryBytes", static_cast<Int>(bytes));
+
+    // HistoryBudget is process-wide: show what another plotter wrote
+    auto& governor = HistoryGovernor::instance();
+    const Int budgetMb = static_cast<Int>(governor.budget() >> 20);
+    if (shownBudgetMb.exchange(budgetMb) != budgetMb)
+        objPtr.asPtr<IPropertyObjectProtected>().setProtectedPropertyValue("HistoryBudget", budgetMb);
+
+    const int level = governor.report(governorClient, report);
+    if (level == historyLevel)
+        return;
+
+    const int previous = historyLevel;
+    historyLevel = level;
+    for (SignalContext* sigCtx : activeSignals)
+        reserveHistory(*sigCtx);
+    framesDirty = true;
+
+    // Decimation follows with the next configureDecimation
+    const std::string state = level == 0   ? std::string("full history restored")
+                              : level == 1 ? std::string("history stored as decimated bins")
+                                           : fmt::format("history shortened to {} s", effectiveHistory());
+    LOG_W("History memory budget of {} MB {}: {}", governor.budget() >> 20, level > previous ? "exceeded" : "relieved", state)
+}
+
+bool QtPlotterFbImpl::updateTrigger()
+{
+    // Auto shows untriggered captures after this long without a trigger, in data time
+    constexpr double MinAutoTimeoutMs = 100.0;
+
+    SignalContext* source = triggerSourceSignal();
+    if (!source || triggerStopped || source->history->isEmpty(source->subscriber))
+        return false;
+
+    const SharedHistory& history = *source->history;
+    const double latest = history.lastTime();
+    const double postMs = settings.postTrigger * 1000.0;
+
+    // Armed: only samples read from now on may trigger
+    if (std::isnan(triggerSearchFrom))
+    {
+        triggerSearchFrom = latest;
+        lastCaptureData = latest;
+        return false;
+    }
+
+    // Only the samples after triggerSearchFrom are searched, so each read block is searched once.
+    // The latest complete capture wins; a capture holds off triggers until it ends.
+    double completed = std::numeric_limits<double>::quiet_NaN();
+    while (true)
+    {
+        if (std::isnan(pendingTrigger))
+        {
+            pendingTrigger = history.findTrigger(source->subscriber, triggerSearchFrom, settings.triggerLevel, settings.triggerEdge);
+            if (std::isnan(pendingTrigger))
             {
-                LOG_W("Error reading data from TimeReader: {}", e.what())
+                triggerSearchFrom = latest;
+                break;
             }
         }
 
-        // Update series name
-        if (series)
+        // Waiting for the post-trigger samples
+        if (latest < pendingTrigger + postMs)
+            break;
+
+        completed = pendingTrigger;
+        pendingTrigger = std::numeric_limits<double>::quiet_NaN();
+        triggerSearchFrom = completed + postMs;
+        if (settings.triggerMode == TriggerMode::Single)
+            break;
+    }
+
+    if (std::isnan(completed) && settings.triggerMode == TriggerMode::Auto && std::isnan(pendingTrigger) &&
+        latest - lastCaptureData >= std::max((settings.preTrigger + settings.postTrigger) * 1000.0, MinAutoTimeoutMs))
+    {
+        completed = latest - postMs;
+        triggerSearchFrom = latest;
+    }
+
+    if (std::isnan(completed))
+        return false;
+
+    captureTime = completed;
+    lastCaptureData = latest;
+    if (settings.triggerMode == TriggerMode::Single)
+        triggerStopped = true;
+    return true;
+}
+
+void QtPlotterFbImpl::rearmTrigger()
+{
+    triggerSearchFrom = std::numeric_limits<double>::quiet_NaN();
+    pendingTrigger = std::numeric_limits<double>::quiet_NaN();
+    triggerStopped = false;
+}
+
+SignalContext* QtPlotterFbImpl::triggerSourceSignal() const
+{
+    // The signal with `triggerSource` connected signals of smaller id
+    for (SignalContext* candidate : activeSignals)
+    {
+        const auto before = std::count_if(activeSignals.begin(), activeSignals.end(),
+                                          [candidate](const SignalContext* other) { return other->id < candidate->id; });
+        if (before == settings.triggerSource)
+            return candidate;
+    }
+    return nullptr;
+}
+
+void QtPlotterFbImpl::publishView()
+{
+    currentView.followLatest = !userInteracting;
+    if (axisX)
+    {
+        currentView.visibleMin = static_cast<double>(axisX->min().toMSecsSinceEpoch());
+        currentView.visibleMax = static_cast<double>(axisX->max().toMSecsSinceEpoch());
+    }
+    currentView.pixelWidth = plotPixelWidth();
+    ++currentView.generation;
+    publishedViewGeneration = currentView.generation;
+
+    viewBuffer.writeBuffer() = currentView;
+    viewBuffer.publish();
+    wakeAcquisition();
+}
+
+void QtPlotterFbImpl::updatePlot()
+{
+    frameNotified = false;
+
+    // Update plot if chart exists and embeddedWidget is available
+    if (!chart || !embeddedWidget)
+        return;
+
+    // Only swap in the latest frame; reading and downsampling happen on the acquisition thread
+    if (!frameBuffer.update())
+        return;
+    const PlotFrame& frame = frameBuffer.readBuffer();
+    const auto frameStart = std::chrono::steady_clock::now();
+
+    // Switching render backend: drop what the other backend still shows
+    if (frame.rasterRenderer != rasterActive)
+    {
+        rasterActive = frame.rasterRenderer;
+        if (rasterActive)
+        {
+            if (!rasterItem)
+                rasterItem = new RasterSeriesItem(chart, axisX, axisY);
+            for (auto& [id, series] : seriesById)
+                if (series)
+                    series->clear();
+        }
+        else if (rasterItem)
+        {
+            rasterItem->clearSignals();
+        }
+    }
+
+    for (const auto& signalFrame : frame.signalFrames)
+    {
+        // Get or create series for this signal
+        QPointer<QLineSeries>& series = seriesById[signalFrame.signalId];
+        if (!series)
+            series = createSeriesForSignal(signalFrame);
+        if (!series)
+            continue;
+
+        // In raster mode the series stays empty and only provides legend entry and pen
+        if (rasterActive && rasterItem)
+            rasterItem->setSignal(signalFrame.signalId, signalFrame.points, series->pen(), series->isVisible());
+        else
+            series->replace(signalFrame.points);
+
+        // Update series name; compared as std::string so unchanged captions cost no conversion
+        std::string& seriesCaption = seriesCaptions[signalFrame.signalId];
+        if (seriesCaption != signalFrame.caption)
+        {
+            seriesCaption = signalFrame.caption;
+            series->setName(QString::fromStdString(seriesCaption));
+        }
+    }
+
+    // Signals missing from the frame were disconnected
+    for (auto it = seriesById.begin(); it != seriesById.end();)
+    {
+        const quint64 id = it->first;
+        const bool connected = std::any_of(frame.signalFrames.begin(),
+                                           frame.signalFrames.end(),
+                                           [id](const SignalFrame& signalFrame) { return signalFrame.signalId == id; });
+        if (connected || !frame.removeDisconnectedSeries)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->second)
         {
-            std::string seriesName = sigCtx.caption;
-            if (series->name() != QString::fromStdString(seriesName))
-                series->setName(QString::fromStdString(seriesName));
+            chart->removeSeries(it->second);
+            it->second->deleteLater();
         }
+        if (rasterItem)
+            rasterItem->removeSignal(it->first);
+        seriesCaptions.erase(it->first);
+        it = seriesById.erase(it);
     }
 
     // Update axis labels and range
-    if (hasData && axisX)
+    if (frame.hasData && axisX)
     {
         // Get current visible range (either from user interaction or auto-follow)
         QDateTime minTime, maxTime;
 
         if (!userInteracting)
         {
-            // Auto-follow mode: show last 'duration' seconds
-            qint64 durationMsec = static_cast<qint64>(duration * 1000);
-            minTime = QDateTime::fromMSecsSinceEpoch(globalLatestTime - durationMsec);
-            maxTime = QDateTime::fromMSecsSinceEpoch(globalLatestTime);
+            // Auto-follow mode: the frame was built for the last 'duration' seconds
+            if (frame.followLatest)
+            {
+                minTime = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(frame.visibleMin));
+                maxTime = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(frame.visibleMax));
+            }
         }
         else
         {
-            // Use current axis range
-            minTime = axisX->min();
-            maxTime = axisX->max();
-            
-            qint64 visibleMin = minTime.toMSecsSinceEpoch();
-            qint64 visibleMax = maxTime.toMSecsSinceEpoch();
+            qint64 visibleMin = axisX->min().toMSecsSinceEpoch();
+            qint64 visibleMax = axisX->max().toMSecsSinceEpoch();
 
             // Check if any signal has data overlapping with visible range (O(n) where n = signals, not points)
             bool hasDataInRange = false;
-            for (const auto& [port, sigCtx] : signalContexts)
+            for (const auto& signalFrame : frame.signalFrames)
             {
-                if (!sigCtx.isSignalConnected)
-                    continue;
-
                 // Check if data time range overlaps with visible range
-                if (sigCtx.dataMaxTime >= visibleMin && sigCtx.dataMinTime <= visibleMax)
+                if (signalFrame.hasData && signalFrame.dataMaxTime >= visibleMin && signalFrame.dataMinTime <= visibleMax)
                 {
                     hasDataInRange = true;
                     break;
@@ -831,18 +1700,17 @@ void QtPlotterFbImpl::updatePlot()
             if (!hasDataInRange)
             {
                 userInteracting = false;
-                qint64 durationMsec = static_cast<qint64>(duration * 1000);
-                minTime = QDateTime::fromMSecsSinceEpoch(globalLatestTime - durationMsec);
-                maxTime = QDateTime::fromMSecsSinceEpoch(globalLatestTime);
                 chart->zoomReset();
+                publishView();
             }
         }
 
         // Update range - QDateTimeAxis handles labels automatically
-        // Visible series will be updated via rangeChanged signal with debouncing
         if (minTime.isValid() && maxTime.isValid() && minTime < maxTime)
         {
+            updatingAxisRange = true;
             axisX->setRange(minTime, maxTime);
+            updatingAxisRange = false;
             axisX->setTickCount(3);
             axisX->setLabelsVisible(true);
             axisX->setFormat("HH:mm:ss.zzz");
@@ -850,86 +1718,37 @@ void QtPlotterFbImpl::updatePlot()
     }
 
     // Auto-scale Y-axis if enabled
-    if (autoScale && axisY && hasData)
+    if (frame.autoScale && axisY && frame.hasData && frame.valueMin < frame.valueMax)
     {
-        qreal minY = std::numeric_limits<qreal>::max();
-        qreal maxY = std::numeric_limits<qreal>::lowest();
-
-        // Use value range from descriptor if available, otherwise use default
-        for (const auto& [port, sigCtx] : signalContexts)
-        {
-            if (!sigCtx.isSignalConnected)
-                continue;
-
-            if (sigCtx.valueRangeMin < sigCtx.valueRangeMax)
-            {
-                // Use range from descriptor
-                if (sigCtx.valueRangeMin < minY)
-                    minY = sigCtx.valueRangeMin;
-                if (sigCtx.valueRangeMax > maxY)
-                    maxY = sigCtx.valueRangeMax;
-            }
-        }
-
-        // Fall back to default range if no valid ranges from descriptors
-        if (minY >= maxY)
-        {
-            minY = defaultMinY;
-            maxY = defaultMaxY;
-        }
-
-        if (minY < maxY)
-        {
-            qreal margin = (maxY - minY) * 0.1;
-            axisY->setRange(minY - margin, maxY + margin);
-            axisY->setTickCount(5);
-        }
+        qreal margin = (frame.valueMax - frame.valueMin) * 0.1;
+        axisY->setRange(frame.valueMin - margin, frame.valueMax + margin);
+        axisY->setTickCount(5);
     }
     
     // Update markers when plot updates
     updateMarkers();
+
+    guiFrameCostUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frameStart).count();
 }
 
-double QtPlotterFbImpl::getSignalValueAtTime(QLineSeries* series, qint64 timeMsec)
+void QtPlotterFbImpl::setPlotVisible(bool visible)
 {
-    if (!series || series->count() == 0)
-        return std::numeric_limits<double>::quiet_NaN();
-
-    const auto& points = series->points();
-    int n = points.size();
-
-    // Handle edge cases
-    if (timeMsec <= static_cast<qint64>(points.first().x()))
-        return points.first().y();
-    if (timeMsec >= static_cast<qint64>(points.last().x()))
-        return points.last().y();
-
-    // Use binary search to find the interval containing timeMsec
-    // Find first index where points[i].x() >= timeMsec
-    int right = binarySearchFirstGE(points, timeMsec);
-    
-    // If right is 0, we're at the beginning (already handled above)
-    // If right >= n, we're at the end (already handled above)
-    if (right <= 0 || right >= n)
-    {
-        // Fallback: should not happen due to edge cases above, but handle it
-        if (right >= n)
-            return points.last().y();
-        return points.first().y();
-    }
-    
-    // left is the point before right
-    int left = right - 1;
-
-    // Linear interpolation between points[left] and points[right]
-    qint64 t1 = static_cast<qint64>(points[left].x());
-    qint64 t2 = static_cast<qint64>(points[right].x());
+    if (plotVisible.exchange(visible) == visible)
+        return;
 
-    if (t2 == t1)
-        return points[left].y();
+    // Becoming visible needs a frame for the current view right away
+    if (visible)
+        publishView();
+    else
+        wakeAcquisition();
+}
 
-    double ratio = static_cast<double>(timeMsec - t1) / static_cast<double>(t2 - t1);
-    return points[left].y() + ratio * (points[right].y() - points[left].y());
+double QtPlotterFbImpl::getSignalValueAtTime(const SignalContext& sigCtx, qint64 timeMsec) const
+{
+    // Interpolate on the full-resolution history rather than the downsampled series
+    if (!sigCtx.history)
+        return std::numeric_limits<double>::quiet_NaN();
+    return sigCtx.history->valueAtTime(sigCtx.subscriber, static_cast<double>(timeMsec));
 }
 
 QPointF QtPlotterFbImpl::constrainLabelPosition(const QPointF& pos, const QRectF& labelRect, const QRectF& plotArea)
@@ -988,16 +1807,20 @@ void QtPlotterFbImpl::addMarkerAtTime(qint64 timeMsec)
     // Find intersections with all signal series
     QStringList valueLabels;
     QList<QPointF> valuePositions;  // Store positions for value labels
-    for (auto* series : chart->series())
     {
-        auto* lineSeries = qobject_cast<QLineSeries*>(series);
-        if (lineSeries && lineSeries->count() > 0 && !lineSeries->name().isEmpty() && lineSeries != verticalLine)
+        // History is written by the acquisition thread
+        auto lock = getRecursiveConfigLock();
+        for (const auto& [port, sigCtx] : signalContexts)
         {
-            double value = getSignalValueAtTime(lineSeries, timeMsec);
+            QLineSeries* series = seriesForSignal(sigCtx);
+            if (!sigCtx.isSignalConnected || !series)
+                continue;
+
+            double value = getSignalValueAtTime(sigCtx, timeMsec);
             if (!std::isnan(value))
             {
                 valuePoints->append(timeMsec, value);
-                valueLabels.append(QString("%1: %2").arg(lineSeries->name()).arg(value, 0, 'g', 6));
+                valueLabels.append(QString("%1: %2").arg(series->name()).arg(value, 0, 'g', 6));
                 valuePositions.append(QPointF(timeMsec, value));
             }
         }
@@ -1195,16 +2018,18 @@ void QtPlotterFbImpl::moveMarker(int index, qint64 newTimeMsec)
         marker.valueLabels.clear();
 
         // Find new intersections with signal series using signalContexts (O(signals) not O(all series))
+        auto lock = getRecursiveConfigLock();
         for (const auto& [port, sigCtx] : signalContexts)
         {
-            if (!sigCtx.isSignalConnected || !sigCtx.series)
+            QLineSeries* series = seriesForSignal(sigCtx);
+            if (!sigCtx.isSignalConnected || !series)
                 continue;
 
-            double value = getSignalValueAtTime(sigCtx.series, newTimeMsec);
+            double value = getSignalValueAtTime(sigCtx, newTimeMsec);
             if (!std::isnan(value))
             {
                 marker.valuePoints->append(newTimeMsec, value);
-                marker.valueLabels.append(QString("%1: %2").arg(sigCtx.series->name()).arg(value, 0, 'g', 6));
+                marker.valueLabels.append(QString("%1: %2").arg(series->name()).arg(value, 0, 'g', 6));
                 marker.valuePositions.append(QPointF(newTimeMsec, value));
             }
         }
@@ -1274,6 +2099,8 @@ void QtPlotterFbImpl::moveMarker(int index, qint64 newTimeMsec)
     // Update delete button position if it exists
     if (marker.deleteButton)
         showDeleteButton(index);
+
+    updateMeasurement();
 }
 
 void QtPlotterFbImpl::removeMarker(int index)
@@ -1317,6 +2144,7 @@ void QtPlotterFbImpl::removeMarker(int index)
     }
     
     markers.removeAt(index);
+    updateMeasurement();
 }
 
 void QtPlotterFbImpl::updateMarkers()
@@ -1362,7 +2190,7 @@ void QtPlotterFbImpl::updateMarkers()
         // Update value labels positions
         if (marker.valuePoints && chartView->scene())
         {
-            const auto& points = marker.valuePoints->points();
+            const auto& points = marker.valuePositions;
             QRectF plotArea = chart->plotArea();
             for (int i = 0; i < marker.valueLabelsItems.size() && i < points.size(); ++i)
             {
@@ -1382,6 +2210,60 @@ void QtPlotterFbImpl::updateMarkers()
         if (marker.deleteButton && marker.deleteButton->isVisible())
             showDeleteButton(markerIndex);
     }
+
+    updateMeasurement();
+}
+
+void QtPlotterFbImpl::updateMeasurement()
+{
+    // The first two markers are the measurement cursors
+    if (markers.size() < 2 || !chart || !chartView || !chartView->scene())
+    {
+        if (measurementLabel)
+            measurementLabel->setVisible(false);
+        return;
+    }
+
+    const qint64 fromMsec = std::min(markers[0].timeMsec, markers[1].timeMsec);
+    const qint64 toMsec = std::max(markers[0].timeMsec, markers[1].timeMsec);
+    QString text = QString("Δt: %1 ms").arg(toMsec - fromMsec);
+
+    // On the full-resolution history, O(log n) per signal, so dragging stays smooth
+    const PlotFrame& frame = frameBuffer.readBuffer();
+    for (const auto& signalFrame : frame.signalFrames)
+    {
+        if (!signalFrame.history)
+            continue;
+
+        const RangeStatistics stats =
+            signalFrame.history->statistics(signalFrame.subscriber, static_cast<double>(fromMsec), static_cast<double>(toMsec));
+        if (stats.isEmpty())
+            continue;
+
+        text += QString("\n%1: min %2  max %3  mean %4  RMS %5  p-p %6")
+                    .arg(QString::fromStdString(signalFrame.caption))
+                    .arg(stats.min, 0, 'g', 6)
+                    .arg(stats.max, 0, 'g', 6)
+                    .arg(stats.mean(), 0, 'g', 6)
+                    .arg(stats.rms(), 0, 'g', 6)
+                    .arg(stats.peakToPeak(), 0, 'g', 6);
+    }
+
+    if (!measurementLabel)
+    {
+        measurementLabel = new QGraphicsTextItem();
+        QPalette palette = QApplication::palette();
+        measurementLabel->setDefaultTextColor(palette.color(QPalette::Text));
+        QFont font = measurementLabel->font();
+        font.setPointSize(font.pointSize() - 1);
+        measurementLabel->setFont(font);
+        measurementLabel->setZValue(1000);
+        chartView->scene()->addItem(measurementLabel);
+    }
+
+    measurementLabel->setPlainText(text);
+    measurementLabel->setPos(chart->plotArea().topLeft() + QPointF(5, 5));
+    measurementLabel->setVisible(true);
 }
 
 ErrCode QtPlotterFbImpl::getWidget(struct QWidget** widget)
@@ -1448,6 +2330,13 @@ void QtPlotterFbImpl::createChart()
     axisY->setGridLineVisible(showGrid);
     axisY->setTitleBrush(palette.brush(QPalette::Text));
     chart->addAxis(axisY, Qt::AlignLeft);
+
+    // Level-of-detail follows the plot width, so a resize needs new frames
+    QObject::connect(chart, &QChart::plotAreaChanged, [this](const QRectF&)
+    {
+        if (plotPixelWidth() != currentView.pixelWidth)
+            publishView();
+    });
 }
 
 void QtPlotterFbImpl::createWidget()
@@ -1459,6 +2348,11 @@ void QtPlotterFbImpl::createWidget()
     // Clean up timer if it exists
     if (updateTimer)
     {
+        {
+            std::lock_guard<std::mutex> timerLock(frameTimerMutex);
+            frameTimer = nullptr;
+            frameView = nullptr;
+        }
         updateTimer->stop();
         updateTimer->deleteLater();
         updateTimer = nullptr;
@@ -1494,69 +2388,21 @@ void QtPlotterFbImpl::createWidget()
     layout->addWidget(embeddedChartView);
     
     embeddedWidget = widget;
+
+    // Frames are only built while the plot is on screen
+    visibilityFilter = new VisibilityEventFilter(embeddedWidget, this);
+    embeddedWidget->installEventFilter(visibilityFilter);
     
-    // Create debounce timer for visible series updates during zoom/pan
-    if (!visibleUpdateTimer && axisX)
+    // Every zoom/pan step gets a coarse frame right away, refined once the range stays
+    if (axisX)
     {
-        visibleUpdateTimer = new QTimer(embeddedWidget);
-        visibleUpdateTimer->setSingleShot(true);
-        visibleUpdateTimer->setInterval(50); // 50ms debounce delay
-        
-        QObject::connect(visibleUpdateTimer, &QTimer::timeout, [this]()
-        {
-            if (axisX)
-            {
-                qint64 visibleMin = pendingVisibleMin;
-                qint64 visibleMax = pendingVisibleMax;
-                
-                // When zooming stops: restore original values
-                if (isZooming)
-                {
-                    downsampleMethod = static_cast<QtPlotter::DownsampleMethod>(this->objPtr.getPropertyValue("DownsampleMethod").asPtr<IInteger>());
-                    maxSamplesPerSeries = this->objPtr.getPropertyValue("MaxSamplesPerSeries");
-                    isZooming = false;
-                }
-                
-                // Update visible series with restored settings
-                for (auto& [port, sigCtx] : signalContexts)
-                {
-                    if (sigCtx.isSignalConnected && sigCtx.series)
-                    {
-                        updateVisibleSeries(sigCtx, sigCtx.series, visibleMin, visibleMax);
-                    }
-                }
-            }
-        });
-        
-        // Connect axis range change to update visible series (lazy rendering with debouncing)
-        QObject::connect(axisX, &QDateTimeAxis::rangeChanged, [this](QDateTime min, QDateTime max)
+        QObject::connect(axisX, &QDateTimeAxis::rangeChanged, [this](QDateTime, QDateTime)
         {
-            pendingVisibleMin = min.toMSecsSinceEpoch();
-            pendingVisibleMax = max.toMSecsSinceEpoch();
-            
-            // During zooming: save original values and set simple downsampling with 100 max samples
-            if (!isZooming)
-            {
-                downsampleMethod = static_cast<QtPlotter::DownsampleMethod>(this->objPtr.getPropertyValue("DownsampleMethod").asPtr<IInteger>());
-                maxSamplesPerSeries = this->objPtr.getPropertyValue("MaxSamplesPerSeries");
-                isZooming = true;
-            }
-            
-            downsampleMethod = DownsampleMethod::Simple;
-            maxSamplesPerSeries = 100;
-            
-            // Update visible series with zoom settings
-            for (auto& [port, sigCtx] : signalContexts)
-            {
-                if (sigCtx.isSignalConnected && sigCtx.series)
-                {
-                    updateVisibleSeries(sigCtx, sigCtx.series, pendingVisibleMin, pendingVisibleMax);
-                }
-            }
-            
-            // Restart timer - this debounces rapid range changes
-            if (visibleUpdateTimer)
-                visibleUpdateTimer->start();
+            // Auto-follow moves the axis on every frame, that is not a zoom
+            if (updatingAxisRange)
+                return;
+
+            publishView();
         });
     }
 }
@@ -1624,6 +2470,7 @@ void QtPlotterFbImpl::setupButtons(QWidget* toolbarWidget)
         {
             userInteracting = false;
             chart->zoomReset();
+            publishView();
         }
     });
     
@@ -1646,6 +2493,9 @@ void QtPlotterFbImpl::setupButtons(QWidget* toolbarWidget)
     {
         if (chart)
         {
+            // History is cleared by the acquisition thread before its next frame
+            clearRequested = true;
+
             // Clear all series
             for (auto* series : chart->series())
             {
@@ -1653,7 +2503,10 @@ void QtPlotterFbImpl::setupButtons(QWidget* toolbarWidget)
                 if (lineSeries)
                     lineSeries->clear();
             }
+            if (rasterItem)
+                rasterItem->clearSignals();
             userInteracting = false;
+            publishView();
         }
     });
     
@@ -1669,365 +2522,47 @@ void QtPlotterFbImpl::setupTimer()
 {
     if (!updateTimer)
     {
+        // Not periodic: the acquisition thread starts it whenever it publishes a frame
         updateTimer = new QTimer(embeddedWidget);
+        updateTimer->setSingleShot(true);
+        updateTimer->setInterval(0);
         QObject::connect(updateTimer, &QTimer::timeout, [this]()
         {
             // Update plot if embeddedWidget exists
             if (embeddedWidget)
                 updatePlot();
         });
-        updateTimer->start(40);  // Redraw at ~20 FPS
-    }
-}
-
-// Lazy rendering method implementations
-
-int QtPlotterFbImpl::binarySearchFirstGE(const QVector<QPointF>& points, qint64 targetTime) const
-{
-    // Binary search for first index where points[i].x() >= targetTime
-    int left = 0;
-    int right = points.size() - 1;
-    int result = points.size(); // Default: not found, return size (out of bounds)
-    
-    while (left <= right)
-    {
-        int mid = left + (right - left) / 2;
-        qint64 midTime = static_cast<qint64>(points[mid].x());
-        
-        if (midTime >= targetTime)
-        {
-            result = mid;
-            right = mid - 1; // Continue searching in left half
-        }
-        else
-        {
-            left = mid + 1; // Search in right half
-        }
-    }
-    
-    return result;
-}
-
-int QtPlotterFbImpl::binarySearchLastLE(const QVector<QPointF>& points, qint64 targetTime, int startIdx) const
-{
-    // Binary search for last index where points[i].x() <= targetTime
-    // Search starts from startIdx (optimization: we know all points before startIdx are < targetTime)
-    int left = startIdx;
-    int right = points.size() - 1;
-    int result = startIdx - 1; // Default: not found
-    
-    while (left <= right)
-    {
-        int mid = left + (right - left) / 2;
-        qint64 midTime = static_cast<qint64>(points[mid].x());
-        
-        if (midTime <= targetTime)
-        {
-            result = mid;
-            left = mid + 1; // Continue searching in right half
-        }
-        else
-        {
-            right = mid - 1; // Search in left half
-        }
-    }
-    
-    return result;
-}
-
-std::pair<int, int> QtPlotterFbImpl::getVisibleRange(const SignalContext& sigCtx, qint64 visibleMin, qint64 visibleMax) const
-{
-    // Return invalid range if buffer is empty
-    if (sigCtx.pointsBuffer.isEmpty())
-        return std::make_pair(-1, -1);
-
-    int startIdx = binarySearchFirstGE(sigCtx.pointsBuffer, visibleMin);
-    int lastIdx = binarySearchLastLE(sigCtx.pointsBuffer, visibleMax, startIdx);
-
-    // Include nearest invisible point on the left side (if exists) to not lose left boundary point
-    if (startIdx > 0 && startIdx < sigCtx.pointsBuffer.size())
-        startIdx--; // Include previous point to not lose left boundary
-    
-    // Include nearest invisible point on the right side (if exists) to not lose right boundary point
-    if (lastIdx >= 0 && lastIdx + 1 < sigCtx.pointsBuffer.size())
-        lastIdx++; // Include next point to not lose right boundary
-    
-    // Check if we found valid range
-    if (startIdx > lastIdx || startIdx >= sigCtx.pointsBuffer.size() || lastIdx < 0)
-        return std::make_pair(-1, -1);
-    
-    // Ensure indices are within bounds
-    if (startIdx < 0)
-        startIdx = 0;
-    if (lastIdx >= sigCtx.pointsBuffer.size())
-        lastIdx = sigCtx.pointsBuffer.size() - 1;
-    
-    return std::make_pair(startIdx, lastIdx);
-}
-
-void QtPlotterFbImpl::updateVisibleSeries(SignalContext& sigCtx, QLineSeries* series, qint64 visibleMin, qint64 visibleMax)
-{
-    if (!series || sigCtx.pointsBuffer.isEmpty())
-        return;
-    
-    // Get visible range indices from history buffer
-    auto [beginIdx, endIdx] = getVisibleRange(sigCtx, visibleMin, visibleMax);
-    
-    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx)
-    {
-        series->clear();
-        return;
-    }
-    
-    // Calculate visible count
-    size_t visibleCount = endIdx - beginIdx + 1;
-    QVector<QPointF> pointsToShow;
-    
-    // Reserve space for better performance
-    size_t targetSize = std::min(visibleCount, maxSamplesPerSeries);
-    pointsToShow.reserve(targetSize);
-    
-    if (visibleCount > maxSamplesPerSeries && downsampleMethod != DownsampleMethod::None)
-    {
-        size_t targetPoints = maxSamplesPerSeries;
-        
-        switch (downsampleMethod)
+        QObject::connect(updateTimer, &QObject::destroyed, [this](QObject* timer)
         {
-            case DownsampleMethod::None:
-                pointsToShow = downsampleVisibleNone(sigCtx.pointsBuffer, beginIdx, endIdx);
-                break;
-            case DownsampleMethod::Simple:
-                pointsToShow = downsampleVisibleSimple(sigCtx.pointsBuffer, beginIdx, endIdx, targetPoints);
-                break;
-            case DownsampleMethod::MinMax:
-                pointsToShow = downsampleVisibleMinMax(sigCtx.pointsBuffer, beginIdx, endIdx, targetPoints);
-                break;
-            case DownsampleMethod::LTTB:
-                pointsToShow = downsampleVisibleLTTB(sigCtx.pointsBuffer, beginIdx, endIdx, targetPoints);
-                break;
-            default:
-                // Copy all visible points
-                pointsToShow.reserve(visibleCount);
-                for (int i = beginIdx; i <= endIdx; ++i)
-                    pointsToShow.append(sigCtx.pointsBuffer[i]);
-                break;
-        }
-    }
-    else
-    {
-        // No downsampling needed or method is None - copy all visible points
-        pointsToShow.reserve(visibleCount);
-        for (int i = beginIdx; i <= endIdx; ++i)
-            pointsToShow.append(sigCtx.pointsBuffer[i]);
-    }
-    
-    // Update series with downsampled visible points
-    series->replace(pointsToShow);
-}
+            // Goes with embeddedWidget, which is also the frame clock view
+            std::lock_guard<std::mutex> timerLock(frameTimerMutex);
+            if (frameTimer == timer)
+            {
+                frameTimer = nullptr;
+                frameView = nullptr;
+            }
+        });
 
-QVector<QPointF> QtPlotterFbImpl::downsampleVisibleNone(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx) const
-{
-    // No downsampling - return all points in range
-    QVector<QPointF> result;
-    result.reserve(endIdx - beginIdx + 1);
-    for (int i = beginIdx; i <= endIdx; ++i)
-        result.append(pointsBuffer[i]);
-    return result;
-}
+        // The clock forgets the widget when it is destroyed
+        QObject* clock = FrameClockInterface::clock();
+        if (clock)
+            QMetaObject::invokeMethod(clock, "registerView", Qt::DirectConnection,
+                                      Q_ARG(QObject*, embeddedWidget.data()), Q_ARG(int, FrameClockInterface::Normal), Q_ARG(int, 0));
 
-QVector<QPointF> QtPlotterFbImpl::downsampleVisibleSimple(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx, size_t targetPoints) const
-{
-    // Simple downsampling - take every Nth point
-    QVector<QPointF> result;
-    result.reserve(targetPoints);
-    
-    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx || targetPoints == 0)
-        return result;
-    
-    size_t visibleCount = endIdx - beginIdx + 1;
-    if (visibleCount <= targetPoints)
-    {
-        // Return all points
-        for (int i = beginIdx; i <= endIdx; ++i)
-            result.append(pointsBuffer[i]);
-        return result;
-    }
-    
-    size_t step = visibleCount / targetPoints;
-    if (step < 1) step = 1;
-    
-    for (int i = beginIdx; i <= endIdx && result.size() < targetPoints; i += static_cast<int>(step))
-    {
-        result.append(pointsBuffer[i]);
+        std::lock_guard<std::mutex> timerLock(frameTimerMutex);
+        frameTimer = updateTimer;
+        frameClock = clock;
+        frameView = clock ? embeddedWidget.data() : nullptr;
     }
-    
-    return result;
 }
 
-QVector<QPointF> QtPlotterFbImpl::downsampleVisibleMinMax(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx, size_t targetPoints) const
-{
-    // Min-Max downsampling - preserves signal peaks and valleys
-    // Each bucket produces 2 points (min and max)
-    QVector<QPointF> result;
-    
-    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx || targetPoints == 0)
-        return result;
-    
-    size_t visibleCount = endIdx - beginIdx + 1;
-    if (visibleCount <= targetPoints)
-    {
-        // Return all points
-        for (int i = beginIdx; i <= endIdx; ++i)
-            result.append(pointsBuffer[i]);
-        return result;
-    }
-    
-    size_t bucketSize = visibleCount / (targetPoints / 2);  // /2 because each bucket adds 2 points
-    if (bucketSize < 2) bucketSize = 2;
-    
-    // Reserve estimated space (each bucket adds up to 2 points)
-    size_t estimatedPoints = (visibleCount / bucketSize) * 2 + 2;
-    result.reserve(std::min(estimatedPoints, targetPoints));
-    
-    for (int bucketStart = beginIdx; bucketStart <= endIdx && result.size() < targetPoints - 1; bucketStart += static_cast<int>(bucketSize))
-    {
-        int bucketEnd = std::min(bucketStart + static_cast<int>(bucketSize) - 1, endIdx);
-        
-        // Find min and max in bucket
-        double minVal = pointsBuffer[bucketStart].y(), maxVal = pointsBuffer[bucketStart].y();
-        int minIdx = bucketStart, maxIdx = bucketStart;
-        
-        for (int i = bucketStart + 1; i <= bucketEnd; ++i)
-        {
-            if (pointsBuffer[i].y() < minVal) { minVal = pointsBuffer[i].y(); minIdx = i; }
-            if (pointsBuffer[i].y() > maxVal) { maxVal = pointsBuffer[i].y(); maxIdx = i; }
-        }
-        
-        // Add points in time order (important for correct line rendering)
-        if (minIdx < maxIdx)
-        {
-            result.append(pointsBuffer[minIdx]);
-            if (minIdx != maxIdx && result.size() < targetPoints)
-                result.append(pointsBuffer[maxIdx]);
-        }
-        else
-        {
-            result.append(pointsBuffer[maxIdx]);
-            if (result.size() < targetPoints)
-                result.append(pointsBuffer[minIdx]);
-        }
-    }
-    
-    return result;
-}
+// Lazy rendering method implementations
 
-QVector<QPointF> QtPlotterFbImpl::downsampleVisibleLTTB(const QVector<QPointF>& pointsBuffer, int beginIdx, int endIdx, size_t targetPoints) const
+qreal QtPlotterFbImpl::plotPixelWidth() const
 {
-    // Largest Triangle Three Buckets (LTTB) - best visual quality downsampling
-    // Algorithm: https://github.com/sveinn-steinarsson/flot-downsample
-    QVector<QPointF> result;
-    
-    if (beginIdx < 0 || endIdx < 0 || beginIdx > endIdx || targetPoints == 0)
-        return result;
-    
-    size_t count = endIdx - beginIdx + 1;
-    if (count <= targetPoints)
-    {
-        // Return all points
-        for (int i = beginIdx; i <= endIdx; ++i)
-            result.append(pointsBuffer[i]);
-        return result;
-    }
-    
-    if (targetPoints < 3)
-    {
-        // Need at least 3 points for LTTB, fall back to simple
-        return downsampleVisibleSimple(pointsBuffer, beginIdx, endIdx, targetPoints);
-    }
-    
-    result.reserve(targetPoints);
-    
-    // Always include first point
-    result.append(pointsBuffer[beginIdx]);
-    
-    // Calculate bucket size
-    size_t bucketSize = (count - 2) / (targetPoints - 2);  // -2 for first and last points
-    if (bucketSize < 1) bucketSize = 1;
-    
-    int a = beginIdx;  // Index of first point in current bucket (absolute index in pointsBuffer)
-    
-    for (size_t i = 0; i < targetPoints - 2; ++i)
-    {
-        // Calculate range for next bucket (relative to beginIdx)
-        size_t rangeStartRel = (i + 1) * bucketSize;
-        size_t rangeEndRel = std::min((i + 2) * bucketSize, count - 1);
-        int rangeStart = beginIdx + static_cast<int>(rangeStartRel);
-        int rangeEnd = beginIdx + static_cast<int>(rangeEndRel);
-        
-        // Calculate average point of next bucket for triangle comparison
-        double avgX = 0.0, avgY = 0.0;
-        size_t avgCount = 0;
-        for (int j = rangeStart; j <= rangeEnd; ++j)
-        {
-            avgX += pointsBuffer[j].x();
-            avgY += pointsBuffer[j].y();
-            avgCount++;
-        }
-        if (avgCount > 0)
-        {
-            avgX /= avgCount;
-            avgY /= avgCount;
-        }
-        
-        // Calculate range for current bucket (from a+1 to rangeStart)
-        int rangeStartCurr = a + 1;
-        int rangeEndCurr = std::min(rangeStart - 1, endIdx);
-        
-        // Find point in current bucket that forms largest triangle with avg point
-        double maxArea = -1.0;
-        int maxAreaIdx = rangeStartCurr;
-        
-        if (rangeStartCurr <= rangeEndCurr)
-        {
-            double timeA = pointsBuffer[a].x();
-            double valA = pointsBuffer[a].y();
-            
-            for (int j = rangeStartCurr; j <= rangeEndCurr; ++j)
-            {
-                double timeJ = pointsBuffer[j].x();
-                double valJ = pointsBuffer[j].y();
-                
-                // Calculate triangle area using cross product
-                // Area = |(avgX - timeA) * (valJ - valA) - (timeJ - timeA) * (avgY - valA)| / 2
-                double area = std::abs((avgX - timeA) * (valJ - valA) - (timeJ - timeA) * (avgY - valA));
-                
-                if (area > maxArea)
-                {
-                    maxArea = area;
-                    maxAreaIdx = j;
-                }
-            }
-        }
-        
-        // Add the point with largest triangle area
-        if (maxAreaIdx < beginIdx || maxAreaIdx > endIdx)
-            maxAreaIdx = rangeStart - 1;
-        
-        if (maxAreaIdx >= beginIdx && maxAreaIdx <= endIdx)
-        {
-            result.append(pointsBuffer[maxAreaIdx]);
-            a = maxAreaIdx;
-        }
-        else
-        {
-            a = rangeStart;
-        }
-    }
-    
-    // Always include last point
-    result.append(pointsBuffer[endIdx]);
-    
-    return result;
+    if (!chart)
+        return 0.0;
+    return chart->plotArea().width();
 }
 
 }  // namespace QtPlotter
@@ -0,0 +1,585 @@
+#include <opendaq_qt_module/qt_spectrum_fb_impl.h>
+#include <opendaq/custom_log.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_protected_ptr.h>
+#include <QWidget>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QApplication>
+#include <QPalette>
+#include <QGraphicsLayout>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr double MinPower = 1e-30;          // -300 dB, keeps log10 finite for empty bins
+constexpr double AutoScaleRangeDb = 160.0;  // AutoScale shows at most this far below the highest peak
+
+}  // namespace
+
+QtSpectrumFbImpl::QtSpectrumFbImpl(const daq::ContextPtr& ctx,
+                                   const daq::ComponentPtr& parent,
+                                   const daq::StringPtr& localId,
+                                   const daq::PropertyObjectPtr& config)
+    : Super(CreateType(), ctx, parent, localId)
+    , liveView([this]() { acquire(); }, [this]() { updatePlot(); })
+{
+    initProperties();
+    updateInputPorts();
+    createWidget();
+
+    liveView.start();
+}
+
+QtSpectrumFbImpl::~QtSpectrumFbImpl()
+{
+    liveView.stop();
+}
+
+daq::FunctionBlockTypePtr QtSpectrumFbImpl::CreateType()
+{
+    return daq::FunctionBlockType(
+        "opendaq_qt_spectrum",
+        "Qt Spectrum Analyzer",
+        "Real-time FFT spectrum with configurable window, overlap and averaging",
+        daq::PropertyObject()
+    );
+}
+
+void QtSpectrumFbImpl::initProperties()
+{
+    auto onPropertyValueWrite = [this](daq::PropertyObjectPtr& obj, daq::PropertyValueEventArgsPtr& args)
+    {
+        propertyChanged(args.getProperty().getName(), args.getValue());
+    };
+
+    // Sizes with prime factors other than 2, 3 and 5 are rounded up to the next one that has none
+    const auto fftSizeProp = daq::IntPropertyBuilder("FftSize", static_cast<Int>(fftSize))
+                                 .setMinValue(16)
+                                 .setMaxValue(1 << 20)
+                                 .setSuggestedValues(daq::List<daq::Int>(256, 1000, 1024, 4096, 10000, 16384, 65536))
+                                 .build();
+    objPtr.addProperty(fftSizeProp);
+    objPtr.getOnPropertyValueWrite("FftSize") += onPropertyValueWrite;
+
+    const auto windowProp = daq::SelectionProperty(
+        "Window", List<IString>("Rectangular", "Hann", "Hamming", "BlackmanHarris", "FlatTop"), static_cast<Int>(window));
+    objPtr.addProperty(windowProp);
+    objPtr.getOnPropertyValueWrite("Window") += onPropertyValueWrite;
+
+    const auto overlapProp = daq::FloatPropertyBuilder("Overlap", overlap)
+                                 .setMinValue(0.0)
+                                 .setMaxValue(95.0)
+                                 .setSuggestedValues(daq::List<daq::Float>(0.0, 50.0, 66.7, 75.0))
+                                 .setUnit(daq::Unit("%", -1, "percent", "ratio"))
+                                 .build();
+    objPtr.addProperty(overlapProp);
+    objPtr.getOnPropertyValueWrite("Overlap") += onPropertyValueWrite;
+
+    const auto averagingProp = daq::SelectionProperty(
+        "Averaging", List<IString>("None", "Linear", "Exponential", "PeakHold"), static_cast<Int>(averaging));
+    objPtr.addProperty(averagingProp);
+    objPtr.getOnPropertyValueWrite("Averaging") += onPropertyValueWrite;
+
+    // Spectra per linear average; the exponential average weighs each new spectrum 1 / AverageCount
+    const auto averageCountProp = daq::IntPropertyBuilder("AverageCount", averageCount)
+                                      .setMinValue(1)
+                                      .setSuggestedValues(daq::List<daq::Int>(4, 10, 32, 100))
+                                      .build();
+    objPtr.addProperty(averageCountProp);
+    objPtr.getOnPropertyValueWrite("AverageCount") += onPropertyValueWrite;
+
+    const auto scaleProp = daq::SelectionProperty("Scale", List<IString>("dB", "Linear"), static_cast<Int>(scale));
+    objPtr.addProperty(scaleProp);
+    objPtr.getOnPropertyValueWrite("Scale") += onPropertyValueWrite;
+
+    const auto autoScaleProp = daq::BoolProperty("AutoScale", autoScale);
+    objPtr.addProperty(autoScaleProp);
+    objPtr.getOnPropertyValueWrite("AutoScale") += onPropertyValueWrite;
+
+    const auto defaultMinYProp = daq::FloatProperty("DefaultMinY", defaultMinY);
+    objPtr.addProperty(defaultMinYProp);
+    objPtr.getOnPropertyValueWrite("DefaultMinY") += onPropertyValueWrite;
+
+    const auto defaultMaxYProp = daq::FloatProperty("DefaultMaxY", defaultMaxY);
+    objPtr.addProperty(defaultMaxYProp);
+    objPtr.getOnPropertyValueWrite("DefaultMaxY") += onPropertyValueWrite;
+
+    const auto showLegendProp = daq::BoolProperty("ShowLegend", showLegend);
+    objPtr.addProperty(showLegendProp);
+    objPtr.getOnPropertyValueWrite("ShowLegend") += onPropertyValueWrite;
+
+    const auto showGridProp = daq::BoolProperty("ShowGrid", showGrid);
+    objPtr.addProperty(showGridProp);
+    objPtr.getOnPropertyValueWrite("ShowGrid") += onPropertyValueWrite;
+
+    const auto maxFpsProp = daq::IntPropertyBuilder("MaxFps", 30)
+                                .setMinValue(1)
+                                .setMaxValue(240)
+                                .setSuggestedValues(daq::List<daq::Int>(10, 30, 60, 120))
+                                .build();
+    objPtr.addProperty(maxFpsProp);
+    objPtr.getOnPropertyValueWrite("MaxFps") += onPropertyValueWrite;
+
+    // Statistic: average time the acquisition thread spends reading, transforming and reducing per frame
+    const auto frameTimeProp = daq::FloatPropertyBuilder("FrameTime", 0.0)
+                                   .setReadOnly(true)
+                                   .setUnit(daq::Unit("ms", -1, "millisecond", "time"))
+                                   .build();
+    objPtr.addProperty(frameTimeProp);
+}
+
+void QtSpectrumFbImpl::propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value)
+{
+    auto lock = getRecursiveConfigLock();
+
+    if (propertyName == "FftSize")
+    {
+        fftSize = RealFft::supportedSize(static_cast<size_t>(std::max<Int>(value, 16)));
+        if (static_cast<Int>(fftSize) != static_cast<Int>(value))
+            LOG_W("FFT size {} is not supported, using {}", value.toString(), fftSize)
+    }
+    else if (propertyName == "Window")
+        window = static_cast<SpectrumWindow>(value.asPtr<IInteger>(true));
+    else if (propertyName == "Overlap")
+        overlap = value;
+    else if (propertyName == "Averaging")
+        averaging = static_cast<SpectrumAveraging>(value.asPtr<IInteger>(true));
+    else if (propertyName == "AverageCount")
+        averageCount = value;
+    else if (propertyName == "Scale")
+        scale = static_cast<SpectrumScale>(value.asPtr<IInteger>(true));
+    else if (propertyName == "AutoScale")
+        autoScale = value;
+    else if (propertyName == "DefaultMinY")
+        defaultMinY = value;
+    else if (propertyName == "DefaultMaxY")
+        defaultMaxY = value;
+    else if (propertyName == "ShowLegend")
+    {
+        showLegend = value;
+        if (chart)
+            chart->legend()->setVisible(showLegend);
+    }
+    else if (propertyName == "ShowGrid")
+    {
+        showGrid = value;
+        if (axisX)
+            axisX->setGridLineVisible(showGrid);
+        if (axisY)
+            axisY->setGridLineVisible(showGrid);
+    }
+    else if (propertyName == "MaxFps")
+        liveView.setMaxFps(static_cast<int>(static_cast<Int>(value)));
+
+    liveView.invalidate();
+
+    LOG_W("Property {} changed to {}", propertyName, value.toString());
+}
+
+SpectrumSettings QtSpectrumFbImpl::spectrumSettings() const
+{
+    SpectrumSettings settings;
+    settings.fftSize = fftSize;
+    settings.window = window;
+    settings.overlap = overlap / 100.0;
+    settings.averaging = averaging;
+    settings.averageCount = static_cast<int>(std::min<Int>(averageCount, std::numeric_limits<int>::max()));
+    return settings;
+}
+
+void QtSpectrumFbImpl::updateInputPorts()
+{
+    const auto inputPort = createAndAddInputPort(
+        fmt::format("Input{}", inputPortCount++),
+        daq::PacketReadyNotification::SameThread);
+    auto [it, _] = spectrumSignals.try_emplace(inputPort, inputPort, nextSignalId++);
+    it->second.streamReader.setExternalListener(this->template borrowPtr<InputPortNotificationsPtr>());
+}
+
+void QtSpectrumFbImpl::onConnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    auto it = spectrumSignals.find(inputPort);
+    bool createNewPort = true;
+    if (it != spectrumSignals.end())
+    {
+        SpectrumSignal& signal = it->second;
+        createNewPort = !signal.isSignalConnected;
+        signal.isSignalConnected = true;
+        signal.analyzer.reset();
+    }
+
+    if (createNewPort)
+        updateInputPorts();
+    liveView.invalidate();
+
+    LOG_W("Connected to port {}", inputPort.getLocalId());
+}
+
+void QtSpectrumFbImpl::onDisconnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    // The series is removed by the GUI thread once the signal is missing from a published frame
+    spectrumSignals.erase(inputPort);
+    removeInputPort(inputPort);
+    liveView.invalidate();
+
+    LOG_W("Disconnected from port {}", inputPort.getLocalId());
+}
+
+void QtSpectrumFbImpl::onPacketReceived(const daq::InputPortPtr& /*port*/)
+{
+    liveView.packetReceived();
+}
+
+void QtSpectrumFbImpl::acquire()
+{
+    auto lock = getRecursiveConfigLock();
+
+    const bool invalidated = liveView.takeInvalidated();
+    const bool reset = resetRequested.exchange(false);
+    const bool visible = liveView.visible();
+    const auto frameStart = std::chrono::steady_clock::now();
+
+    const SpectrumSettings settings = spectrumSettings();
+    activeSignals.clear();
+    for (auto& [port, signal] : spectrumSignals)
+    {
+        if (!signal.isSignalConnected)
+            continue;
+
+        signal.analyzer.configure(settings);
+        if (reset)
+            signal.analyzer.resetAverage();
+        activeSignals.push_back(&signal);
+    }
+
+    // Signals are independent: read and transform them in parallel. Hidden, the readers are
+    // only drained; the transforms and averages continue once the view is shown again.
+    workerPool->parallelFor(activeSignals.size(), [this, visible](size_t i) { readSignal(*activeSignals[i], visible); });
+
+    bool changed = invalidated || reset;
+    for (const SpectrumSignal* signal : activeSignals)
+        changed = changed || signal->newSpectra > 0;
+
+    if (!changed || !visible)
+        return;
+
+    SpectrumFrame& frame = frameBuffer.writeBuffer();
+    const qreal pixelWidth = plotWidth.load();
+    frame.signalFrames.resize(activeSignals.size());
+    workerPool->parallelFor(activeSignals.size(), [this, &frame, pixelWidth](size_t i)
+    {
+        buildSignalFrame(*activeSignals[i], frame.signalFrames[i], pixelWidth);
+    });
+
+    frame.hasData = false;
+    frame.decibel = scale == SpectrumScale::Decibel;
+    frame.frequencyKnown = false;
+    frame.maxFrequency = 0.0;
+    double minValue = std::numeric_limits<double>::max();
+    double maxValue = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < activeSignals.size(); ++i)
+    {
+        const SpectrumSignal& signal = *activeSignals[i];
+        if (!signal.analyzer.hasSpectrum())
+            continue;
+
+        frame.hasData = true;
+        const double nyquist = signal.sampleRate > 0.0 ? signal.sampleRate / 2.0 : static_cast<double>(signal.analyzer.bins() - 1);
+        frame.maxFrequency = std::max(frame.maxFrequency, nyquist);
+        frame.frequencyKnown = frame.frequencyKnown || signal.sampleRate > 0.0;
+
+        for (const QPointF& point : frame.signalFrames[i].points)
+        {
+            minValue = std::min(minValue, point.y());
+            maxValue = std::max(maxValue, point.y());
+        }
+    }
+
+    if (autoScale && frame.hasData && minValue <= maxValue)
+    {
+        if (scale == SpectrumScale::Decibel)
+            minValue = std::max(minValue, maxValue - AutoScaleRangeDb);
+        else
+            minValue = 0.0;
+        const double margin = std::max((maxValue - minValue) * 0.05, 1e-12);
+        frame.valueMin = minValue - (scale == SpectrumScale::Decibel ? margin : 0.0);
+        frame.valueMax = maxValue + margin;
+    }
+    else
+    {
+        frame.valueMin = defaultMinY;
+        frame.valueMax = defaultMaxY;
+    }
+
+    frameBuffer.publish();
+    liveView.frameReady();
+
+    reportFrameTime(std::chrono::steady_clock::now() - frameStart);
+}
+
+void QtSpectrumFbImpl::readSignal(SpectrumSignal& signal, bool analyse)
+{
+    try
+    {
+        if (signal.read(analyse))
+            liveView.invalidate();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Error reading data from StreamReader: {}", e.what())
+    }
+}
+
+void QtSpectrumFbImpl::buildSignalFrame(const SpectrumSignal& signal, SpectrumSignalFrame& signalFrame, qreal pixelWidth) const
+{
+    signalFrame.signalId = signal.id;
+    signalFrame.caption = signal.caption;
+
+    // Rebuilt in the slot's existing capacity
+    QVector<QPointF>& points = signalFrame.points;
+    points.resize(0);
+    if (!signal.analyzer.hasSpectrum())
+        return;
+
+    const std::vector<double>& power = signal.analyzer.power();
+    const size_t bins = power.size();
+    const double binWidth = signal.sampleRate > 0.0 ? signal.sampleRate / static_cast<double>(signal.analyzer.config().fftSize) : 1.0;
+    const bool decibel = scale == SpectrumScale::Decibel;
+    auto pointAt = [&power, binWidth, decibel](size_t bin)
+    {
+        const double value = decibel ? 10.0 * std::log10(std::max(power[bin], MinPower)) : std::sqrt(power[bin]);
+        return QPointF(static_cast<double>(bin) * binWidth, value);
+    };
+
+    // More bins than pixel columns: the highest bin of each column, so no peak gets lost
+    const size_t columns = static_cast<size_t>(std::max<qreal>(pixelWidth, 100.0));
+    if (bins <= columns * 2)
+    {
+        points.reserve(static_cast<qsizetype>(bins));
+        for (size_t bin = 0; bin < bins; ++bin)
+            points.append(pointAt(bin));
+        return;
+    }
+
+    points.reserve(static_cast<qsizetype>(columns));
+    size_t begin = 0;
+    for (size_t column = 0; column < columns; ++column)
+    {
+        const size_t end = (column + 1) * bins / columns;
+        const auto peak = std::max_element(power.begin() + static_cast<std::ptrdiff_t>(begin), power.begin() + static_cast<std::ptrdiff_t>(end));
+        points.append(pointAt(static_cast<size_t>(peak - power.begin())));
+        begin = end;
+    }
+}
+
+void QtSpectrumFbImpl::reportFrameTime(std::chrono::steady_clock::duration frameTime)
+{
+    // Published about once a second; a property write per frame would flood its listeners
+    constexpr auto ReportPeriod = std::chrono::seconds(1);
+
+    frameTimeSum += frameTime;
+    ++frameTimeCount;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - frameTimeReported < ReportPeriod)
+        return;
+
+    const double averageMs = std::chrono::duration<double, std::milli>(frameTimeSum).count() / frameTimeCount;
+    frameTimeSum = {};
+    frameTimeCount = 0;
+    frameTimeReported = now;
+
+    objPtr.asPtr<IPropertyObjectProtected>().setProtectedPropertyValue("FrameTime", averageMs);
+}
+
+ErrCode QtSpectrumFbImpl::getWidget(struct QWidget** widget)
+{
+    if (widget == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    // Recreate widget if it was deleted by parent
+    if (!embeddedWidget)
+        createWidget();
+
+    if (!embeddedWidget)
+        return OPENDAQ_ERR_NOTFOUND;
+
+    *widget = embeddedWidget;
+    return OPENDAQ_SUCCESS;
+}
+
+void QtSpectrumFbImpl::createWidget()
+{
+    if (!chart)
+    {
+        chart = new QChart();
+        chart->setTitle("Spectrum");
+        chart->setAnimationOptions(QChart::NoAnimation);
+
+        // Use system colors from palette
+        QPalette palette = QApplication::palette();
+        chart->setBackgroundBrush(palette.brush(QPalette::Base));
+        chart->setTitleBrush(palette.brush(QPalette::Text));
+        chart->legend()->setLabelColor(palette.color(QPalette::Text));
+        chart->legend()->setVisible(showLegend);
+        chart->setMargins(QMargins(0, 5, 0, 5));
+        chart->layout()->setContentsMargins(0, 0, 0, 0);
+
+        axisX = new QValueAxis();
+        axisX->setLabelsColor(palette.color(QPalette::Text));
+        axisX->setGridLineVisible(showGrid);
+        axisX->setTitleBrush(palette.brush(QPalette::Text));
+        axisX->setLabelFormat("%g");
+        chart->addAxis(axisX, Qt::AlignBottom);
+
+        axisY = new QValueAxis();
+        axisY->setTickCount(5);
+        axisY->setLabelsColor(palette.color(QPalette::Text));
+        axisY->setGridLineVisible(showGrid);
+        axisY->setTitleBrush(palette.brush(QPalette::Text));
+        axisY->setLabelFormat("%g");
+        chart->addAxis(axisY, Qt::AlignLeft);
+
+        // Spectra are reduced to the plot width, so a resize needs a new frame
+        QObject::connect(chart, &QChart::plotAreaChanged, [this](const QRectF& plotArea)
+        {
+            if (plotArea.width() != plotWidth.load())
+            {
+                plotWidth = plotArea.width();
+                liveView.invalidate();
+            }
+        });
+    }
+
+    auto* widget = new QWidget();
+    auto* layout = new QVBoxLayout(widget);
+    layout->setContentsMargins(0, 0, 0, 0);
+
+    auto* toolbarWidget = new QWidget(widget);
+    auto* toolbarLayout = new QHBoxLayout(toolbarWidget);
+    toolbarLayout->setContentsMargins(5, 5, 5, 5);
+
+    auto* freezeBtn = new QPushButton("Freeze", toolbarWidget);
+    freezeBtn->setToolTip("Freeze/Unfreeze spectrum updates");
+    freezeBtn->setCheckable(true);
+    freezeBtn->setMaximumWidth(70);
+
+    auto* resetBtn = new QPushButton("Reset Average", toolbarWidget);
+    resetBtn->setToolTip("Start averaging and peak hold over");
+    resetBtn->setMaximumWidth(120);
+
+    toolbarLayout->addWidget(freezeBtn);
+    toolbarLayout->addWidget(resetBtn);
+    toolbarLayout->addStretch();
+    layout->addWidget(toolbarWidget);
+
+    QObject::connect(freezeBtn, &QPushButton::toggled, [this, freezeBtn](bool checked)
+    {
+        this->setActive(!checked);
+        if (checked)
+        {
+            freezeBtn->setText("Unfreeze");
+            freezeBtn->setStyleSheet("background-color: #ff6b6b; color: white;");
+        }
+        else
+        {
+            freezeBtn->setText("Freeze");
+            freezeBtn->setStyleSheet("");
+        }
+    });
+
+    QObject::connect(resetBtn, &QPushButton::clicked, [this]()
+    {
+        // Averages are reset by the acquisition thread before its next frame
+        resetRequested = true;
+        liveView.wake();
+    });
+
+    auto* chartView = new QChartView(chart, widget);
+    chartView->setRenderHint(QPainter::Antialiasing);
+    layout->addWidget(chartView);
+
+    embeddedWidget = widget;
+    liveView.attach(embeddedWidget);
+}
+
+void QtSpectrumFbImpl::updatePlot()
+{
+    if (!chart || !embeddedWidget)
+        return;
+
+    // Only swap in the latest frame; transforms and reduction happen on the acquisition thread
+    if (!frameBuffer.update())
+        return;
+    const SpectrumFrame& frame = frameBuffer.readBuffer();
+
+    for (const auto& signalFrame : frame.signalFrames)
+    {
+        QPointer<QLineSeries>& series = seriesById[signalFrame.signalId];
+        if (!series)
+        {
+            series = new QLineSeries();
+            chart->addSeries(series);
+            series->attachAxis(axisX);
+            series->attachAxis(axisY);
+        }
+
+        series->replace(signalFrame.points);
+        const QString caption = QString::fromStdString(signalFrame.caption);
+        if (series->name() != caption)
+            series->setName(caption);
+    }
+
+    // Signals missing from the frame were disconnected
+    for (auto it = seriesById.begin(); it != seriesById.end();)
+    {
+        const quint64 id = it->first;
+        const bool connected = std::any_of(frame.signalFrames.begin(),
+                                           frame.signalFrames.end(),
+                                           [id](const SpectrumSignalFrame& signalFrame) { return signalFrame.signalId == id; });
+        if (connected)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->second)
+        {
+            chart->removeSeries(it->second);
+            it->second->deleteLater();
+        }
+        it = seriesById.erase(it);
+    }
+
+    if (frame.hasData && frame.maxFrequency > 0.0)
+    {
+        axisX->setRange(0.0, frame.maxFrequency);
+        axisX->setTitleText(frame.frequencyKnown ? "Frequency [Hz]" : "Bin");
+    }
+    if (frame.valueMin < frame.valueMax)
+        axisY->setRange(frame.valueMin, frame.valueMax);
+    axisY->setTitleText(frame.decibel ? "Amplitude [dB]" : "Amplitude");
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
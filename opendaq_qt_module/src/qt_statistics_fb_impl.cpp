@@ -0,0 +1,709 @@
+#include <opendaq_qt_module/qt_statistics_fb_impl.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/packet_factory.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_protected_ptr.h>
+#include <coreobjects/unit_factory.h>
+#include <QWidget>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QApplication>
+#include <QPalette>
+#include <QGraphicsLayout>
+#include <QHeaderView>
+#include <QTableWidget>
+#include <QSplitter>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr size_t MinReadBuffer = 200;  // Like the plotter's read buffers
+
+// Output signals, port properties and table columns, in this order
+constexpr std::array<const char*, 7> StatisticNames{"Min", "Max", "Mean", "StdDev", "Rms", "SampleRate", "Dropped"};
+constexpr std::array<const char*, 7> StatisticHeaders{"Min", "Max", "Mean", "Std dev", "RMS", "Rate [Hz]", "Dropped"};
+
+std::array<double, StatisticNames.size()> statisticValues(const StatisticsSnapshot& statistics)
+{
+    return {statistics.min, statistics.max, statistics.mean, statistics.stdDev, statistics.rms,
+            statistics.sampleRate, static_cast<double>(statistics.dropped)};
+}
+
+}  // namespace
+
+QtStatisticsFbImpl::QtStatisticsFbImpl(const daq::ContextPtr& ctx,
+                                       const daq::ComponentPtr& parent,
+                                       const daq::StringPtr& localId,
+                                       const daq::PropertyObjectPtr& config)
+    : Super(CreateType(), ctx, parent, localId)
+    , liveView([this]() { acquire(); }, [this]() { updatePlot(); })
+{
+    initProperties();
+    updateInputPorts();
+    createWidget();
+
+    liveView.start();
+}
+
+QtStatisticsFbImpl::~QtStatisticsFbImpl()
+{
+    liveView.stop();
+}
+
+daq::FunctionBlockTypePtr QtStatisticsFbImpl::CreateType()
+{
+    return daq::FunctionBlockType(
+        "opendaq_qt_statistics",
+        "Qt Statistics",
+        "Histogram and running statistics of signals, also published as output signals",
+        daq::PropertyObject()
+    );
+}
+
+void QtStatisticsFbImpl::initProperties()
+{
+    auto onPropertyValueWrite = [this](daq::PropertyObjectPtr& obj, daq::PropertyValueEventArgsPtr& args)
+    {
+        propertyChanged(args.getProperty().getName(), args.getValue());
+    };
+
+    // Window of the table, the histogram, the output signals and the port properties
+    const auto statisticsProp = daq::SelectionProperty(
+        "Statistics", List<IString>("Sliding", "Cumulative"), static_cast<Int>(statisticsWindow));
+    objPtr.addProperty(statisticsProp);
+    objPtr.getOnPropertyValueWrite("Statistics") += onPropertyValueWrite;
+
+    // Moves in steps of a sixteenth of its length
+    const auto slidingWindowProp = daq::FloatPropertyBuilder("SlidingWindow", slidingWindow)
+                                       .setMinValue(0.001)
+                                       .setSuggestedValues(daq::List<daq::Float>(0.1, 1.0, 10.0, 60.0))
+                                       .setUnit(daq::Unit("s", -1, "second", "time"))
+                                       .build();
+    objPtr.addProperty(slidingWindowProp);
+    objPtr.getOnPropertyValueWrite("SlidingWindow") += onPropertyValueWrite;
+
+    const auto binsProp = daq::IntPropertyBuilder("Bins", bins)
+                              .setMinValue(1)
+                              .setMaxValue(4096)
+                              .setSuggestedValues(daq::List<daq::Int>(16, 64, 256, 1024))
+                              .build();
+    objPtr.addProperty(binsProp);
+    objPtr.getOnPropertyValueWrite("Bins") += onPropertyValueWrite;
+
+    // Histogram range follows the data; a range that has to grow restarts the histograms
+    const auto autoRangeProp = daq::BoolProperty("AutoRange", autoRange);
+    objPtr.addProperty(autoRangeProp);
+    objPtr.getOnPropertyValueWrite("AutoRange") += onPropertyValueWrite;
+
+    const auto histogramMinProp = daq::FloatProperty("HistogramMin", histogramMin);
+    objPtr.addProperty(histogramMinProp);
+    objPtr.getOnPropertyValueWrite("HistogramMin") += onPropertyValueWrite;
+
+    const auto histogramMaxProp = daq::FloatProperty("HistogramMax", histogramMax);
+    objPtr.addProperty(histogramMaxProp);
+    objPtr.getOnPropertyValueWrite("HistogramMax") += onPropertyValueWrite;
+
+    // Output packets and port property updates; writes per frame would flood their listeners
+    const auto reportIntervalProp = daq::FloatPropertyBuilder("ReportInterval", reportInterval)
+                                        .setMinValue(0.05)
+                                        .setSuggestedValues(daq::List<daq::Float>(0.1, 0.5, 1.0, 10.0))
+                                        .setUnit(daq::Unit("s", -1, "second", "time"))
+                                        .build();
+    objPtr.addProperty(reportIntervalProp);
+    objPtr.getOnPropertyValueWrite("ReportInterval") += onPropertyValueWrite;
+
+    const auto maxFpsProp = daq::IntPropertyBuilder("MaxFps", 30)
+                                .setMinValue(1)
+                                .setMaxValue(240)
+                                .setSuggestedValues(daq::List<daq::Int>(10, 30, 60, 120))
+                                .build();
+    objPtr.addProperty(maxFpsProp);
+    objPtr.getOnPropertyValueWrite("MaxFps") += onPropertyValueWrite;
+}
+
+void QtStatisticsFbImpl::propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value)
+{
+    auto lock = getRecursiveConfigLock();
+
+    if (propertyName == "Statistics")
+        statisticsWindow = static_cast<StatisticsWindow>(value.asPtr<IInteger>(true));
+    else if (propertyName == "SlidingWindow")
+        slidingWindow = value;
+    else if (propertyName == "Bins")
+        bins = value;
+    else if (propertyName == "AutoRange")
+        autoRange = value;
+    else if (propertyName == "HistogramMin")
+        histogramMin = value;
+    else if (propertyName == "HistogramMax")
+        histogramMax = value;
+    else if (propertyName == "ReportInterval")
+        reportInterval = value;
+    else if (propertyName == "MaxFps")
+        liveView.setMaxFps(static_cast<int>(static_cast<Int>(value)));
+
+    liveView.invalidate();
+
+    LOG_W("Property {} changed to {}", propertyName, value.toString());
+}
+
+StatisticsSettings QtStatisticsFbImpl::statisticsSettings() const
+{
+    StatisticsSettings settings;
+    settings.window = slidingWindow;
+    settings.bins = static_cast<int>(std::clamp<Int>(bins, 1, std::numeric_limits<int>::max()));
+    settings.autoRange = autoRange;
+    settings.histogramMin = histogramMin;
+    settings.histogramMax = histogramMax;
+    return settings;
+}
+
+void QtStatisticsFbImpl::updateInputPorts()
+{
+    const auto inputPort = createAndAddInputPort(
+        fmt::format("Input{}", inputPortCount++),
+        daq::PacketReadyNotification::SameThread);
+
+    // The statistics of a port can be read from the port itself, without the GUI
+    for (const char* name : StatisticNames)
+        inputPort.addProperty(daq::FloatPropertyBuilder(name, 0.0).setReadOnly(true).build());
+
+    auto [it, _] = statisticsSignals.try_emplace(inputPort, inputPort, nextSignalId++);
+    it->second.streamReader.setExternalListener(this->template borrowPtr<InputPortNotificationsPtr>());
+}
+
+void QtStatisticsFbImpl::onConnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    auto it = statisticsSignals.find(inputPort);
+    bool createNewPort = true;
+    if (it != statisticsSignals.end())
+    {
+        StatisticsSignal& signal = it->second;
+        createNewPort = !signal.isSignalConnected;
+        signal.isSignalConnected = true;
+        signal.statistics.reset();
+        if (signal.outputs.empty())
+            createOutputs(signal);
+    }
+
+    if (createNewPort)
+        updateInputPorts();
+    liveView.invalidate();
+
+    LOG_W("Connected to port {}", inputPort.getLocalId());
+}
+
+void QtStatisticsFbImpl::onDisconnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    // The series and the table row are removed by the GUI thread once the signal is missing from a published frame
+    auto it = statisticsSignals.find(inputPort);
+    if (it != statisticsSignals.end())
+        removeOutputs(it->second);
+    statisticsSignals.erase(inputPort);
+    removeInputPort(inputPort);
+    liveView.invalidate();
+
+    LOG_W("Disconnected from port {}", inputPort.getLocalId());
+}
+
+void QtStatisticsFbImpl::onPacketReceived(const daq::InputPortPtr& /*port*/)
+{
+    liveView.packetReceived();
+}
+
+void QtStatisticsFbImpl::createOutputs(StatisticsSignal& signal)
+{
+    const std::string portId = signal.inputPort.getLocalId().toStdString();
+
+    // Descriptors follow with the input's; until then the outputs have none and stay silent
+    signal.domainOutput = createAndAddSignal(fmt::format("{}Time", portId), nullptr, false);
+    for (const char* name : StatisticNames)
+    {
+        auto output = createAndAddSignal(fmt::format("{}{}", portId, name));
+        output.setDomainSignal(signal.domainOutput);
+        signal.outputs.push_back(output);
+    }
+}
+
+void QtStatisticsFbImpl::updateOutputDescriptors(StatisticsSignal& signal)
+{
+    signal.outputDescriptorsStale = false;
+    if (!signal.domainOutput.assigned() || !signal.domainDescriptor.assigned())
+        return;
+
+    // Statistics are reported at irregular ticks of the input's domain
+    signal.domainOutput.setDescriptor(daq::DataDescriptorBuilderCopy(signal.domainDescriptor)
+                                          .setSampleType(daq::SampleType::Int64)
+                                          .setRule(daq::ExplicitDataRule())
+                                          .build());
+
+    daq::UnitPtr valueUnit;
+    if (signal.valueDescriptor.assigned())
+        valueUnit = signal.valueDescriptor.getUnit();
+
+    for (size_t i = 0; i < signal.outputs.size(); ++i)
+    {
+        const std::string name = StatisticNames[i];
+        auto builder = daq::DataDescriptorBuilder().setSampleType(daq::SampleType::Float64).setName(name);
+        if (name == "SampleRate")
+            builder.setUnit(daq::Unit("Hz", -1, "hertz", "frequency"));
+        else if (name != "Dropped" && valueUnit.assigned())
+            builder.setUnit(valueUnit);
+        signal.outputs[i].setDescriptor(builder.build());
+    }
+}
+
+void QtStatisticsFbImpl::removeOutputs(StatisticsSignal& signal)
+{
+    for (const auto& output : signal.outputs)
+        removeSignal(output);
+    if (signal.domainOutput.assigned())
+        removeSignal(signal.domainOutput);
+    signal.outputs.clear();
+    signal.domainOutput = nullptr;
+}
+
+void QtStatisticsFbImpl::acquire()
+{
+    auto lock = getRecursiveConfigLock();
+
+    const bool invalidated = liveView.takeInvalidated();
+    const bool reset = resetRequested.exchange(false);
+    const bool visible = liveView.visible();
+
+    const StatisticsSettings settings = statisticsSettings();
+    activeSignals.clear();
+    for (auto& [port, signal] : statisticsSignals)
+    {
+        if (!signal.isSignalConnected)
+            continue;
+
+        signal.statistics.configure(settings);
+        if (reset)
+            signal.statistics.reset();
+        activeSignals.push_back(&signal);
+    }
+
+    // Signals are independent: read and accumulate them in parallel. Unlike the plot
+    // views, accumulation continues while hidden, for the outputs and properties.
+    workerPool->parallelFor(activeSignals.size(), [this](size_t i) { readSignal(*activeSignals[i]); });
+
+    bool changed = invalidated || reset;
+    for (StatisticsSignal* signal : activeSignals)
+    {
+        if (signal->outputDescriptorsStale)
+            updateOutputDescriptors(*signal);
+        changed = changed || signal->newSamples > 0;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - lastReport >= std::chrono::duration<double>(reportInterval))
+    {
+        lastReport = now;
+        report();
+    }
+
+    if (!changed || !visible)
+        return;
+
+    StatisticsFrame& frame = frameBuffer.writeBuffer();
+    frame.signalFrames.resize(activeSignals.size());
+    workerPool->parallelFor(activeSignals.size(), [this, &frame](size_t i)
+    {
+        buildSignalFrame(*activeSignals[i], frame.signalFrames[i]);
+    });
+
+    frame.hasHistogram = false;
+    frame.histogramMin = std::numeric_limits<double>::max();
+    frame.histogramMax = std::numeric_limits<double>::lowest();
+    frame.maxShare = 0.0;
+    for (size_t i = 0; i < activeSignals.size(); ++i)
+    {
+        const QVector<QPointF>& histogram = frame.signalFrames[i].histogram;
+        if (histogram.isEmpty())
+            continue;
+
+        frame.hasHistogram = true;
+        frame.histogramMin = std::min(frame.histogramMin, histogram.front().x());
+        frame.histogramMax = std::max(frame.histogramMax, histogram.back().x());
+        for (const QPointF& point : histogram)
+            frame.maxShare = std::max(frame.maxShare, point.y());
+    }
+
+    frameBuffer.publish();
+    liveView.frameReady();
+}
+
+void QtStatisticsFbImpl::readSignal(StatisticsSignal& signal)
+{
+    signal.newSamples = 0;
+    if (!signal.streamReader.assigned())
+        return;
+
+    try
+    {
+        // A read stops at an event; the samples behind it are read right away, not on the next wake-up
+        for (;;)
+        {
+            const size_t available = signal.streamReader.getAvailableCount();
+            const size_t bufferSize = std::max(available, MinReadBuffer);
+            if (signal.valueBuffer.size() < bufferSize)
+            {
+                signal.valueBuffer.resize(bufferSize);
+                signal.tickBuffer.resize(bufferSize);
+            }
+
+            daq::SizeT count = available;
+            daq::ReaderStatusPtr status;
+            signal.streamReader.readWithDomain(signal.valueBuffer.data(), signal.tickBuffer.data(), &count, 0, &status);
+            if (count > 0)
+            {
+                signal.statistics.add(signal.valueBuffer.data(), signal.tickBuffer.data(), count);
+                signal.newSamples += count;
+            }
+
+            daq::EventPacketPtr eventPacket;
+            if (status.assigned())
+                eventPacket = status.getEventPacket();
+            if (!eventPacket.assigned())
+                break;
+            handleEventPacket(signal, eventPacket);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Error reading data from StreamReader: {}", e.what())
+    }
+}
+
+void QtStatisticsFbImpl::handleEventPacket(StatisticsSignal& signal, const daq::EventPacketPtr& eventPacket)
+{
+    if (eventPacket.getEventId() != event_packet_id::DATA_DESCRIPTOR_CHANGED)
+        return;
+
+    auto sig = signal.inputPort.getSignal();
+    signal.caption = sig.assigned() ? sig.getName().toStdString() : "N/A";
+
+    const DataDescriptorPtr descriptor = eventPacket.getParameters()[event_packet_param::DATA_DESCRIPTOR];
+    if (descriptor.assigned())
+    {
+        signal.valueDescriptor = descriptor;
+        auto unit = descriptor.getUnit();
+        if (unit.assigned() && !unit.getSymbol().toStdString().empty())
+            signal.caption += fmt::format(" [{}]", unit.getSymbol().toStdString());
+    }
+
+    // Window length and sample rate need the tick resolution, dropped samples a linear rule
+    const DataDescriptorPtr domainDescriptor = eventPacket.getParameters()[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
+    if (domainDescriptor.assigned())
+    {
+        signal.domainDescriptor = domainDescriptor;
+
+        double secondsPerTick = 0.0;
+        auto tickResolution = domainDescriptor.getTickResolution();
+        if (tickResolution.assigned())
+            secondsPerTick = static_cast<double>(tickResolution.getNumerator()) /
+                             static_cast<double>(tickResolution.getDenominator());
+
+        int64_t linearDelta = 0;
+        auto rule = domainDescriptor.getRule();
+        if (rule.assigned() && rule.getType() == DataRuleType::Linear)
+        {
+            const double delta = rule.getParameters().get("delta");
+            if (delta >= 1.0 && delta == std::floor(delta))
+                linearDelta = static_cast<int64_t>(delta);
+        }
+
+        signal.statistics.setDomain(secondsPerTick, linearDelta);
+    }
+    else
+        signal.statistics.reset();
+
+    signal.outputDescriptorsStale = true;
+}
+
+void QtStatisticsFbImpl::report()
+{
+    const bool sliding = statisticsWindow == StatisticsWindow::Sliding;
+    for (StatisticsSignal* signal : activeSignals)
+    {
+        const StatisticsSnapshot statistics = sliding ? signal->statistics.sliding() : signal->statistics.cumulative();
+        if (statistics.count == 0)
+            continue;
+
+        const auto values = statisticValues(statistics);
+        auto portProperties = signal->inputPort.asPtr<IPropertyObjectProtected>();
+        for (size_t i = 0; i < values.size(); ++i)
+            portProperties.setProtectedPropertyValue(StatisticNames[i], values[i]);
+
+        const auto domainDescriptor = signal->domainOutput.assigned() ? signal->domainOutput.getDescriptor() : nullptr;
+        if (!domainDescriptor.assigned())
+            continue;
+
+        // One sample per output, all on one domain packet
+        const auto domainPacket = daq::DataPacket(domainDescriptor, 1);
+        *static_cast<int64_t*>(domainPacket.getRawData()) = signal->statistics.latestTick();
+        for (size_t i = 0; i < signal->outputs.size(); ++i)
+        {
+            const auto& output = signal->outputs[i];
+            const auto packet = daq::DataPacketWithDomain(domainPacket, output.getDescriptor(), 1);
+            *static_cast<double*>(packet.getRawData()) = values[i];
+            output.sendPacket(packet);
+        }
+    }
+}
+
+void QtStatisticsFbImpl::buildSignalFrame(const StatisticsSignal& signal, StatisticsSignalFrame& signalFrame) const
+{
+    const bool sliding = statisticsWindow == StatisticsWindow::Sliding;
+    signalFrame.signalId = signal.id;
+    signalFrame.caption = signal.caption;
+    signalFrame.statistics = sliding ? signal.statistics.sliding() : signal.statistics.cumulative();
+
+    // Rebuilt in the slot's existing capacity
+    QVector<QPointF>& points = signalFrame.histogram;
+    points.resize(0);
+
+    thread_local std::vector<uint64_t> counts;
+    if (!signal.statistics.histogram(sliding, counts) || counts.empty())
+        return;
+
+    uint64_t total = 0;
+    for (uint64_t count : counts)
+        total += count;
+    if (total == 0)
+        return;
+
+    // Step outline: both edges of every bin at its height
+    const double low = signal.statistics.histogramMin();
+    const double binWidth = (signal.statistics.histogramMax() - low) / static_cast<double>(counts.size());
+    const double toPercent = 100.0 / static_cast<double>(total);
+    points.reserve(static_cast<qsizetype>(counts.size() * 2));
+    for (size_t bin = 0; bin < counts.size(); ++bin)
+    {
+        const double share = static_cast<double>(counts[bin]) * toPercent;
+        points.append(QPointF(low + static_cast<double>(bin) * binWidth, share));
+        points.append(QPointF(low + static_cast<double>(bin + 1) * binWidth, share));
+    }
+}
+
+ErrCode QtStatisticsFbImpl::getWidget(struct QWidget** widget)
+{
+    if (widget == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    // Recreate widget if it was deleted by parent
+    if (!embeddedWidget)
+        createWidget();
+
+    if (!embeddedWidget)
+        return OPENDAQ_ERR_NOTFOUND;
+
+    *widget = embeddedWidget;
+    return OPENDAQ_SUCCESS;
+}
+
+void QtStatisticsFbImpl::createWidget()
+{
+    if (!chart)
+    {
+        chart = new QChart();
+        chart->setTitle("Histogram");
+        chart->setAnimationOptions(QChart::NoAnimation);
+
+        // Use system colors from palette
+        QPalette palette = QApplication::palette();
+        chart->setBackgroundBrush(palette.brush(QPalette::Base));
+        chart->setTitleBrush(palette.brush(QPalette::Text));
+        chart->legend()->setLabelColor(palette.color(QPalette::Text));
+        chart->setMargins(QMargins(0, 5, 0, 5));
+        chart->layout()->setContentsMargins(0, 0, 0, 0);
+
+        axisX = new QValueAxis();
+        axisX->setLabelsColor(palette.color(QPalette::Text));
+        axisX->setTitleBrush(palette.brush(QPalette::Text));
+        axisX->setLabelFormat("%g");
+        chart->addAxis(axisX, Qt::AlignBottom);
+
+        axisY = new QValueAxis();
+        axisY->setTickCount(5);
+        axisY->setLabelsColor(palette.color(QPalette::Text));
+        axisY->setTitleBrush(palette.brush(QPalette::Text));
+        axisY->setTitleText("Samples [%]");
+        axisY->setLabelFormat("%g");
+        chart->addAxis(axisY, Qt::AlignLeft);
+    }
+
+    auto* widget = new QWidget();
+    auto* layout = new QVBoxLayout(widget);
+    layout->setContentsMargins(0, 0, 0, 0);
+
+    auto* toolbarWidget = new QWidget(widget);
+    auto* toolbarLayout = new QHBoxLayout(toolbarWidget);
+    toolbarLayout->setContentsMargins(5, 5, 5, 5);
+
+    auto* freezeBtn = new QPushButton("Freeze", toolbarWidget);
+    freezeBtn->setToolTip("Freeze/Unfreeze statistics updates");
+    freezeBtn->setCheckable(true);
+    freezeBtn->setMaximumWidth(70);
+
+    auto* resetBtn = new QPushButton("Reset", toolbarWidget);
+    resetBtn->setToolTip("Start the statistics and histograms over");
+    resetBtn->setMaximumWidth(70);
+
+    toolbarLayout->addWidget(freezeBtn);
+    toolbarLayout->addWidget(resetBtn);
+    toolbarLayout->addStretch();
+    layout->addWidget(toolbarWidget);
+
+    QObject::connect(freezeBtn, &QPushButton::toggled, [this, freezeBtn](bool checked)
+    {
+        this->setActive(!checked);
+        if (checked)
+        {
+            freezeBtn->setText("Unfreeze");
+            freezeBtn->setStyleSheet("background-color: #ff6b6b; color: white;");
+        }
+        else
+        {
+            freezeBtn->setText("Freeze");
+            freezeBtn->setStyleSheet("");
+        }
+    });
+
+    QObject::connect(resetBtn, &QPushButton::clicked, [this]()
+    {
+        // Statistics are reset by the acquisition thread before its next frame
+        resetRequested = true;
+        liveView.wake();
+    });
+
+    auto* splitter = new QSplitter(Qt::Vertical, widget);
+
+    auto* tableWidget = new QTableWidget(0, static_cast<int>(StatisticHeaders.size()) + 1, splitter);
+    QStringList headers{"Signal"};
+    for (const char* header : StatisticHeaders)
+        headers << header;
+    tableWidget->setHorizontalHeaderLabels(headers);
+    tableWidget->verticalHeader()->setVisible(false);
+    tableWidget->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    tableWidget->setSelectionMode(QAbstractItemView::NoSelection);
+    splitter->addWidget(tableWidget);
+
+    auto* chartView = new QChartView(chart, splitter);
+    chartView->setRenderHint(QPainter::Antialiasing);
+    splitter->addWidget(chartView);
+    splitter->setStretchFactor(1, 1);
+    layout->addWidget(splitter);
+
+    table = tableWidget;
+    embeddedWidget = widget;
+    liveView.attach(embeddedWidget);
+}
+
+void QtStatisticsFbImpl::updatePlot()
+{
+    if (!chart || !table || !embeddedWidget)
+        return;
+
+    // Only swap in the latest frame; accumulation and binning happen on the acquisition thread
+    if (!frameBuffer.update())
+        return;
+    const StatisticsFrame& frame = frameBuffer.readBuffer();
+
+    // Table: one row per signal, items reused between frames
+    const int rows = static_cast<int>(frame.signalFrames.size());
+    if (table->rowCount() != rows)
+        table->setRowCount(rows);
+    auto setCell = [this](int row, int column, const QString& text)
+    {
+        QTableWidgetItem* item = table->item(row, column);
+        if (!item)
+            table->setItem(row, column, new QTableWidgetItem(text));
+        else if (item->text() != text)
+            item->setText(text);
+    };
+
+    for (int row = 0; row < rows; ++row)
+    {
+        const StatisticsSignalFrame& signalFrame = frame.signalFrames[static_cast<size_t>(row)];
+        setCell(row, 0, QString::fromStdString(signalFrame.caption));
+
+        const bool hasData = signalFrame.statistics.count > 0;
+        const auto values = statisticValues(signalFrame.statistics);
+        for (size_t i = 0; i < values.size(); ++i)
+            setCell(row, static_cast<int>(i) + 1, hasData ? QString::number(values[i], 'g', 6) : QString("-"));
+    }
+
+    for (const auto& signalFrame : frame.signalFrames)
+    {
+        QPointer<QLineSeries>& series = seriesById[signalFrame.signalId];
+        if (!series)
+        {
+            series = new QLineSeries();
+            chart->addSeries(series);
+            series->attachAxis(axisX);
+            series->attachAxis(axisY);
+        }
+
+        series->replace(signalFrame.histogram);
+        const QString caption = QString::fromStdString(signalFrame.caption);
+        if (series->name() != caption)
+            series->setName(caption);
+    }
+
+    // Signals missing from the frame were disconnected
+    for (auto it = seriesById.begin(); it != seriesById.end();)
+    {
+        const quint64 id = it->first;
+        const bool connected = std::any_of(frame.signalFrames.begin(),
+                                           frame.signalFrames.end(),
+                                           [id](const StatisticsSignalFrame& signalFrame) { return signalFrame.signalId == id; });
+        if (connected)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->second)
+        {
+            chart->removeSeries(it->second);
+            it->second->deleteLater();
+        }
+        it = seriesById.erase(it);
+    }
+
+    if (frame.hasHistogram && frame.histogramMin < frame.histogramMax)
+    {
+        axisX->setRange(frame.histogramMin, frame.histogramMax);
+        axisY->setRange(0.0, std::max(frame.maxShare * 1.05, 1.0));
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,485 @@
+#include <opendaq_qt_module/qt_waterfall_fb_impl.h>
+#include <opendaq/custom_log.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <QWidget>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QApplication>
+#include <QPalette>
+#include <QPainter>
+#include <QResizeEvent>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr double MinPower = 1e-30;  // -300 dB, keeps log10 finite for empty bins
+constexpr int FrequencyTicks = 5;
+constexpr int TickLength = 4;
+
+}  // namespace
+
+WaterfallWidget::WaterfallWidget(std::function<void(int width, int rows)> onResize, QWidget* parent)
+    : QWidget(parent)
+    , resized(std::move(onResize))
+{
+    setMinimumSize(200, 100);
+    setAttribute(Qt::WA_OpaquePaintEvent);
+}
+
+void WaterfallWidget::detach()
+{
+    resized = nullptr;
+}
+
+void WaterfallWidget::setFrequencyRange(double maxFrequency, bool known)
+{
+    frequencyMax = maxFrequency;
+    frequencyKnown = known;
+}
+
+void WaterfallWidget::setTimeSpan(double seconds)
+{
+    timeSpan = seconds;
+}
+
+QRect WaterfallWidget::plotRect() const
+{
+    // Frequency labels below the image
+    return rect().adjusted(0, 0, 0, -(fontMetrics().height() + TickLength + 2));
+}
+
+void WaterfallWidget::paintEvent(QPaintEvent* /*event*/)
+{
+    QPainter painter(this);
+    const QPalette& palette = QApplication::palette();
+    painter.fillRect(rect(), palette.brush(QPalette::Base));
+
+    // One image row per pixel row, so the blits are not scaled
+    const QRect plot = plotRect();
+    waterfall.draw(painter, plot);
+
+    painter.setPen(palette.color(QPalette::Text));
+    if (frequencyMax > 0.0)
+    {
+        const QFontMetrics metrics = fontMetrics();
+        for (int tick = 0; tick < FrequencyTicks; ++tick)
+        {
+            const double fraction = static_cast<double>(tick) / (FrequencyTicks - 1);
+            const int x = plot.left() + static_cast<int>(std::lround(fraction * (plot.width() - 1)));
+            painter.drawLine(x, plot.bottom() + 1, x, plot.bottom() + TickLength);
+
+            const QString label = QString::number(fraction * frequencyMax, 'g', 4) + (frequencyKnown && tick == FrequencyTicks - 1 ? " Hz" : "");
+            const int labelWidth = metrics.horizontalAdvance(label);
+            const int labelX = std::clamp(x - labelWidth / 2, plot.left(), plot.right() - labelWidth);
+            painter.drawText(labelX, plot.bottom() + TickLength + 1 + metrics.ascent(), label);
+        }
+    }
+
+    // The newest row is at the top; the bottom row is timeSpan old
+    if (timeSpan > 0.0)
+    {
+        painter.setPen(Qt::white);
+        const QRect labelRect = plot.adjusted(4, 2, -4, -2);
+        painter.drawText(labelRect, Qt::AlignTop | Qt::AlignLeft, "0 s");
+        painter.drawText(labelRect, Qt::AlignBottom | Qt::AlignLeft, QString("-%1 s").arg(timeSpan, 0, 'g', 3));
+    }
+}
+
+void WaterfallWidget::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+
+    const QRect plot = plotRect();
+    const int width = std::max(plot.width(), 1);
+    const int rows = std::max(plot.height(), 1);
+    if (width == waterfall.width() && rows == waterfall.rows())
+        return;
+
+    waterfall.resize(width, rows);
+    if (resized)
+        resized(width, rows);
+}
+
+QtWaterfallFbImpl::QtWaterfallFbImpl(const daq::ContextPtr& ctx,
+                                     const daq::ComponentPtr& parent,
+                                     const daq::StringPtr& localId,
+                                     const daq::PropertyObjectPtr& config)
+    : Super(CreateType(), ctx, parent, localId)
+    , liveView([this]() { acquire(); }, [this]() { updatePlot(); })
+{
+    initProperties();
+    createInputPort();
+    createWidget();
+
+    liveView.start();
+}
+
+QtWaterfallFbImpl::~QtWaterfallFbImpl()
+{
+    // The widget belongs to its parent and may outlive this block
+    if (waterfallWidget)
+        waterfallWidget->detach();
+    liveView.stop();
+}
+
+daq::FunctionBlockTypePtr QtWaterfallFbImpl::CreateType()
+{
+    return daq::FunctionBlockType(
+        "opendaq_qt_waterfall",
+        "Qt Waterfall",
+        "Scrolling spectrogram of a signal: frequency across, time downwards, power as colour",
+        daq::PropertyObject()
+    );
+}
+
+void QtWaterfallFbImpl::initProperties()
+{
+    auto onPropertyValueWrite = [this](daq::PropertyObjectPtr& obj, daq::PropertyValueEventArgsPtr& args)
+    {
+        propertyChanged(args.getProperty().getName(), args.getValue());
+    };
+
+    // Sizes with prime factors other than 2, 3 and 5 are rounded up to the next one that has none
+    const auto fftSizeProp = daq::IntPropertyBuilder("FftSize", static_cast<Int>(fftSize))
+                                 .setMinValue(16)
+                                 .setMaxValue(1 << 20)
+                                 .setSuggestedValues(daq::List<daq::Int>(256, 512, 1024, 4096, 16384))
+                                 .build();
+    objPtr.addProperty(fftSizeProp);
+    objPtr.getOnPropertyValueWrite("FftSize") += onPropertyValueWrite;
+
+    const auto windowProp = daq::SelectionProperty(
+        "Window", List<IString>("Rectangular", "Hann", "Hamming", "BlackmanHarris", "FlatTop"), static_cast<Int>(window));
+    objPtr.addProperty(windowProp);
+    objPtr.getOnPropertyValueWrite("Window") += onPropertyValueWrite;
+
+    const auto overlapProp = daq::FloatPropertyBuilder("Overlap", overlap)
+                                 .setMinValue(0.0)
+                                 .setMaxValue(95.0)
+                                 .setSuggestedValues(daq::List<daq::Float>(0.0, 50.0, 66.7, 75.0))
+                                 .setUnit(daq::Unit("%", -1, "percent", "ratio"))
+                                 .build();
+    objPtr.addProperty(overlapProp);
+    objPtr.getOnPropertyValueWrite("Overlap") += onPropertyValueWrite;
+
+    // Time shown from top to bottom; spectra of one row period are averaged into a row.
+    // Rows never get shorter than one spectrum, so short durations may show more time.
+    const auto durationProp = daq::FloatPropertyBuilder("Duration", duration)
+                                  .setMinValue(0.1)
+                                  .setSuggestedValues(daq::List<daq::Float>(1.0, 10.0, 60.0, 600.0))
+                                  .setUnit(daq::Unit("s", -1, "second", "time"))
+                                  .build();
+    objPtr.addProperty(durationProp);
+    objPtr.getOnPropertyValueWrite("Duration") += onPropertyValueWrite;
+
+    const auto colorMapProp = daq::SelectionProperty(
+        "ColorMap", List<IString>("Jet", "Inferno", "Grayscale"), static_cast<Int>(colorMap));
+    objPtr.addProperty(colorMapProp);
+    objPtr.getOnPropertyValueWrite("ColorMap") += onPropertyValueWrite;
+
+    // Power mapped to the first and the last colour of the map
+    const auto minDbProp = daq::FloatPropertyBuilder("MinDb", minDb)
+                               .setUnit(daq::Unit("dB", -1, "decibel", "ratio"))
+                               .build();
+    objPtr.addProperty(minDbProp);
+    objPtr.getOnPropertyValueWrite("MinDb") += onPropertyValueWrite;
+
+    const auto maxDbProp = daq::FloatPropertyBuilder("MaxDb", maxDb)
+                               .setUnit(daq::Unit("dB", -1, "decibel", "ratio"))
+                               .build();
+    objPtr.addProperty(maxDbProp);
+    objPtr.getOnPropertyValueWrite("MaxDb") += onPropertyValueWrite;
+
+    const auto maxFpsProp = daq::IntPropertyBuilder("MaxFps", 30)
+                                .setMinValue(1)
+                                .setMaxValue(240)
+                                .setSuggestedValues(daq::List<daq::Int>(10, 30, 60, 120))
+                                .build();
+    objPtr.addProperty(maxFpsProp);
+    objPtr.getOnPropertyValueWrite("MaxFps") += onPropertyValueWrite;
+}
+
+void QtWaterfallFbImpl::propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value)
+{
+    auto lock = getRecursiveConfigLock();
+
+    if (propertyName == "FftSize")
+    {
+        fftSize = RealFft::supportedSize(static_cast<size_t>(std::max<Int>(value, 16)));
+        if (static_cast<Int>(fftSize) != static_cast<Int>(value))
+            LOG_W("FFT size {} is not supported, using {}", value.toString(), fftSize)
+    }
+    else if (propertyName == "Window")
+        window = static_cast<SpectrumWindow>(value.asPtr<IInteger>(true));
+    else if (propertyName == "Overlap")
+        overlap = value;
+    else if (propertyName == "Duration")
+        duration = value;
+    else if (propertyName == "ColorMap")
+    {
+        colorMap = static_cast<ColorMap>(value.asPtr<IInteger>(true));
+        colorTable = makeColorTable(colorMap);
+    }
+    else if (propertyName == "MinDb")
+        minDb = value;
+    else if (propertyName == "MaxDb")
+        maxDb = value;
+    else if (propertyName == "MaxFps")
+        liveView.setMaxFps(static_cast<int>(static_cast<Int>(value)));
+
+    liveView.invalidate();
+
+    LOG_W("Property {} changed to {}", propertyName, value.toString());
+}
+
+void QtWaterfallFbImpl::createInputPort()
+{
+    // One signal per waterfall; the port stays when its signal is disconnected
+    const auto inputPort = createAndAddInputPort("Input", daq::PacketReadyNotification::SameThread);
+    source = std::make_unique<SpectrumSignal>(inputPort, 1);
+    source->streamReader.setExternalListener(this->template borrowPtr<InputPortNotificationsPtr>());
+}
+
+void QtWaterfallFbImpl::onConnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    source->isSignalConnected = true;
+    source->analyzer.reset();
+    rowSpectra = 0;
+    liveView.invalidate();
+
+    LOG_W("Connected to port {}", inputPort.getLocalId());
+}
+
+void QtWaterfallFbImpl::onDisconnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    // The rows drawn so far stay and scroll out as the next signal's rows come in
+    source->isSignalConnected = false;
+    source->analyzer.reset();
+    rowSpectra = 0;
+    liveView.invalidate();
+
+    LOG_W("Disconnected from port {}", inputPort.getLocalId());
+}
+
+void QtWaterfallFbImpl::onPacketReceived(const daq::InputPortPtr& /*port*/)
+{
+    liveView.packetReceived();
+}
+
+void QtWaterfallFbImpl::acquire()
+{
+    auto lock = getRecursiveConfigLock();
+
+    const bool invalidated = liveView.takeInvalidated();
+    const bool visible = liveView.visible();
+    if (!source->isSignalConnected)
+    {
+        if (invalidated && visible)
+            liveView.frameReady();
+        return;
+    }
+
+    SpectrumSettings settings;
+    settings.fftSize = fftSize;
+    settings.window = window;
+    settings.overlap = overlap / 100.0;
+    settings.averaging = SpectrumAveraging::None;
+    source->analyzer.configure(settings);
+
+    // A new width needs a new row; the queue was reset by the GUI thread with the image
+    const int width = imageWidth.load();
+    const int rows = imageRows.load();
+    if (width != rowWidth)
+    {
+        rowWidth = width;
+        rowPixels.assign(static_cast<size_t>(std::max(width, 0)), 0);
+        rowSpectra = 0;
+    }
+
+    // Hidden, the reader is only drained; no rows are built that nobody would see scroll by
+    rowsEmitted = 0;
+    try
+    {
+        const bool analyse = visible && width > 0;
+        if (source->read(analyse, [this](const std::vector<double>& power) { addSpectrum(power); }))
+        {
+            // Frequency scale and row period change with the descriptors
+            rowSpectra = 0;
+            liveView.invalidate();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Error reading data from StreamReader: {}", e.what())
+    }
+
+    // Row period from the sample rate, for the rows of the next read
+    const double hop = static_cast<double>(source->analyzer.hopSize());
+    if (source->sampleRate > 0.0 && rows > 0 && hop > 0.0)
+    {
+        const double samplesPerRow = source->sampleRate * duration / rows;
+        spectraPerRow = static_cast<int>(std::clamp<double>(std::lround(samplesPerRow / hop), 1.0, std::numeric_limits<int>::max()));
+        timeSpan = rows * spectraPerRow * hop / source->sampleRate;
+    }
+    else
+    {
+        spectraPerRow = 1;
+        timeSpan = 0.0;
+    }
+
+    const double bins = static_cast<double>(source->analyzer.bins());
+    frequencyKnown = source->sampleRate > 0.0;
+    frequencyMax = source->sampleRate > 0.0 ? source->sampleRate / 2.0 : std::max(bins - 1.0, 0.0);
+
+    if ((rowsEmitted > 0 || invalidated) && visible)
+        liveView.frameReady();
+}
+
+void QtWaterfallFbImpl::addSpectrum(const std::vector<double>& power)
+{
+    if (rowPower.size() != power.size())
+    {
+        rowPower.assign(power.size(), 0.0);
+        rowSpectra = 0;
+    }
+    else if (rowSpectra == 0)
+        std::fill(rowPower.begin(), rowPower.end(), 0.0);
+
+    for (size_t bin = 0; bin < power.size(); ++bin)
+        rowPower[bin] += power[bin];
+
+    if (++rowSpectra >= spectraPerRow)
+        emitRow();
+}
+
+void QtWaterfallFbImpl::emitRow()
+{
+    const size_t bins = rowPower.size();
+    const size_t columns = rowPixels.size();
+    if (bins == 0 || columns == 0)
+        return;
+
+    // Power to colour index: linear in dB over [minDb, maxDb], the peak bin of each column
+    const double scale = 255.0 / std::max(maxDb - minDb, 1e-6);
+    const double offset = 10.0 * std::log10(static_cast<double>(rowSpectra)) + minDb;
+    for (size_t column = 0; column < columns; ++column)
+    {
+        const size_t begin = column * bins / columns;
+        const size_t end = std::max(begin + 1, (column + 1) * bins / columns);
+        const double peak = *std::max_element(rowPower.begin() + static_cast<std::ptrdiff_t>(begin),
+                                              rowPower.begin() + static_cast<std::ptrdiff_t>(std::min(end, bins)));
+        const double level = (10.0 * std::log10(std::max(peak, MinPower)) - offset) * scale;
+        rowPixels[column] = colorTable[static_cast<size_t>(std::clamp(level, 0.0, 255.0))];
+    }
+
+    rowQueue.push(rowPixels.data(), static_cast<int>(columns));
+    rowSpectra = 0;
+    ++rowsEmitted;
+}
+
+ErrCode QtWaterfallFbImpl::getWidget(struct QWidget** widget)
+{
+    if (widget == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    // Recreate widget if it was deleted by parent
+    if (!embeddedWidget)
+        createWidget();
+
+    if (!embeddedWidget)
+        return OPENDAQ_ERR_NOTFOUND;
+
+    *widget = embeddedWidget;
+    return OPENDAQ_SUCCESS;
+}
+
+void QtWaterfallFbImpl::createWidget()
+{
+    auto* widget = new QWidget();
+    auto* layout = new QVBoxLayout(widget);
+    layout->setContentsMargins(0, 0, 0, 0);
+
+    auto* toolbarWidget = new QWidget(widget);
+    auto* toolbarLayout = new QHBoxLayout(toolbarWidget);
+    toolbarLayout->setContentsMargins(5, 5, 5, 5);
+
+    auto* freezeBtn = new QPushButton("Freeze", toolbarWidget);
+    freezeBtn->setToolTip("Freeze/Unfreeze waterfall updates");
+    freezeBtn->setCheckable(true);
+    freezeBtn->setMaximumWidth(70);
+
+    auto* clearBtn = new QPushButton("Clear", toolbarWidget);
+    clearBtn->setToolTip("Clear the waterfall");
+    clearBtn->setMaximumWidth(70);
+
+    toolbarLayout->addWidget(freezeBtn);
+    toolbarLayout->addWidget(clearBtn);
+    toolbarLayout->addStretch();
+    layout->addWidget(toolbarWidget);
+
+    QObject::connect(freezeBtn, &QPushButton::toggled, [this, freezeBtn](bool checked)
+    {
+        this->setActive(!checked);
+        if (checked)
+        {
+            freezeBtn->setText("Unfreeze");
+            freezeBtn->setStyleSheet("background-color: #ff6b6b; color: white;");
+        }
+        else
+        {
+            freezeBtn->setText("Freeze");
+            freezeBtn->setStyleSheet("");
+        }
+    });
+
+    // Resizes come from the GUI thread; the acquisition thread picks the new width up on its
+    // next read, rows queued for the old size are dropped
+    auto* view = new WaterfallWidget([this](int width, int rows)
+    {
+        rowQueue.reset(width, rows);
+        imageRows = rows;
+        imageWidth = width;
+        liveView.invalidate();
+    }, widget);
+    layout->addWidget(view);
+
+    QObject::connect(clearBtn, &QPushButton::clicked, [view]()
+    {
+        view->image().clear();
+        view->update();
+    });
+
+    embeddedWidget = widget;
+    waterfallWidget = view;
+    liveView.attach(embeddedWidget);
+}
+
+void QtWaterfallFbImpl::updatePlot()
+{
+    if (!waterfallWidget)
+        return;
+
+    // Rows were coloured on the acquisition thread; only copy them into the image
+    rowQueue.drain(waterfallWidget->image());
+    waterfallWidget->setFrequencyRange(frequencyMax.load(), frequencyKnown.load());
+    waterfallWidget->setTimeSpan(timeSpan.load());
+    waterfallWidget->update();
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
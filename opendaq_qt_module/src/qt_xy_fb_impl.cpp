@@ -0,0 +1,558 @@
+#include <opendaq_qt_module/qt_xy_fb_impl.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <QWidget>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QApplication>
+#include <QPalette>
+#include <QPainter>
+#include <QImage>
+#include <QResizeEvent>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr double RangeMargin = 0.1;   // Auto range: fraction of the span added on each side
+constexpr double RangeGrowth = 0.25;  // Extra room when the range has to grow, so drift does not clear the raster every frame
+constexpr int LabelMargin = 4;
+
+// Signal name and unit of a port, from a descriptor event of its reader
+std::string captionOf(const daq::InputPortPtr& port, const daq::EventPacketPtr& eventPacket)
+{
+    auto sig = port.getSignal();
+    std::string caption = sig.assigned() ? sig.getName().toStdString() : "N/A";
+
+    const DataDescriptorPtr descriptor = eventPacket.getParameters()[event_packet_param::DATA_DESCRIPTOR];
+    if (descriptor.assigned())
+    {
+        auto unit = descriptor.getUnit();
+        if (unit.assigned() && !unit.getSymbol().toStdString().empty())
+            caption += fmt::format(" [{}]", unit.getSymbol().toStdString());
+    }
+    return caption;
+}
+
+// Range of the finite values, false if there are none
+bool finiteRange(const double* values, size_t count, double& low, double& high)
+{
+    low = std::numeric_limits<double>::max();
+    high = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!std::isfinite(values[i]))
+            continue;
+        low = std::min(low, values[i]);
+        high = std::max(high, values[i]);
+    }
+    return low <= high;
+}
+
+// Auto range of one axis: padded around the data, grown with room to spare once data leaves it
+bool fitAxis(double low, double high, double& rangeMin, double& rangeMax)
+{
+    if (rangeMax > rangeMin && low >= rangeMin && high <= rangeMax)
+        return false;
+
+    if (rangeMax > rangeMin)
+    {
+        const double growth = (std::max(high, rangeMax) - std::min(low, rangeMin)) * RangeGrowth;
+        if (low < rangeMin)
+            rangeMin = low - growth;
+        if (high > rangeMax)
+            rangeMax = high + growth;
+        return true;
+    }
+
+    const double span = high - low;
+    const double margin = span > 0.0 ? span * RangeMargin : std::max(std::abs(low) * RangeMargin, 1.0);
+    rangeMin = low - margin;
+    rangeMax = high + margin;
+    return true;
+}
+
+}  // namespace
+
+XyWidget::XyWidget(std::function<void(int width, int height)> onResize, QWidget* parent)
+    : QWidget(parent)
+    , resized(std::move(onResize))
+{
+    setMinimumSize(150, 150);
+    setAttribute(Qt::WA_OpaquePaintEvent);
+}
+
+void XyWidget::detach()
+{
+    resized = nullptr;
+}
+
+void XyWidget::setFrame(const XyFrame* newFrame)
+{
+    frame = newFrame;
+}
+
+QRect XyWidget::plotRect() const
+{
+    // Y labels on the left, X labels below
+    const QFontMetrics metrics = fontMetrics();
+    const int left = metrics.horizontalAdvance("-0.0000e+00") + LabelMargin;
+    const int bottom = 2 * metrics.height() + LabelMargin;
+    return rect().adjusted(left, LabelMargin, -LabelMargin, -bottom);
+}
+
+void XyWidget::paintEvent(QPaintEvent* /*event*/)
+{
+    QPainter painter(this);
+    const QPalette& palette = QApplication::palette();
+    painter.fillRect(rect(), palette.brush(QPalette::Base));
+
+    const QRect plot = plotRect();
+    painter.setPen(palette.color(QPalette::Text));
+    painter.drawRect(plot.adjusted(-1, -1, 0, 0));
+
+    // Frames of an old size are left out until the raster of the new one is published
+    if (!frame || frame->width != plot.width() || frame->height != plot.height())
+        return;
+
+    // The raster has one cell per pixel; wrap it without a copy
+    const QImage image(reinterpret_cast<const uchar*>(frame->pixels.data()),
+                       frame->width,
+                       frame->height,
+                       static_cast<qsizetype>(frame->width) * static_cast<qsizetype>(sizeof(QRgb)),
+                       QImage::Format_RGB32);
+    painter.drawImage(plot.topLeft(), image);
+
+    const QFontMetrics metrics = fontMetrics();
+    const QString xLow = QString::number(frame->xMin, 'g', 4);
+    const QString xHigh = QString::number(frame->xMax, 'g', 4);
+    const int xLabelY = plot.bottom() + LabelMargin + metrics.ascent();
+    painter.drawText(plot.left(), xLabelY, xLow);
+    painter.drawText(plot.right() - metrics.horizontalAdvance(xHigh), xLabelY, xHigh);
+
+    const QString xTitle = QString::fromStdString(frame->xCaption);
+    painter.drawText(plot.center().x() - metrics.horizontalAdvance(xTitle) / 2, xLabelY + metrics.height(), xTitle);
+
+    const QString yLow = QString::number(frame->yMin, 'g', 4);
+    const QString yHigh = QString::number(frame->yMax, 'g', 4);
+    painter.drawText(plot.left() - LabelMargin - metrics.horizontalAdvance(yHigh), plot.top() + metrics.ascent(), yHigh);
+    painter.drawText(plot.left() - LabelMargin - metrics.horizontalAdvance(yLow), plot.bottom(), yLow);
+
+    painter.save();
+    painter.translate(plot.left() - LabelMargin - metrics.descent(), plot.center().y());
+    painter.rotate(-90);
+    const QString yTitle = QString::fromStdString(frame->yCaption);
+    painter.drawText(-metrics.horizontalAdvance(yTitle) / 2, 0, yTitle);
+    painter.restore();
+}
+
+void XyWidget::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+
+    const QRect plot = plotRect();
+    if (resized)
+        resized(std::max(plot.width(), 1), std::max(plot.height(), 1));
+}
+
+QtXyFbImpl::QtXyFbImpl(const daq::ContextPtr& ctx,
+                       const daq::ComponentPtr& parent,
+                       const daq::StringPtr& localId,
+                       const daq::PropertyObjectPtr& config)
+    : Super(CreateType(), ctx, parent, localId)
+    , liveView([this]() { acquire(); }, [this]() { updatePlot(); })
+{
+    initProperties();
+
+    // Read together by one MultiReader, which takes over the ports' notifications
+    xPort = createAndAddInputPort("X", daq::PacketReadyNotification::SameThread);
+    yPort = createAndAddInputPort("Y", daq::PacketReadyNotification::SameThread);
+
+    createWidget();
+
+    liveView.start();
+}
+
+QtXyFbImpl::~QtXyFbImpl()
+{
+    // The widget belongs to its parent and may outlive this block
+    if (xyWidget)
+    {
+        xyWidget->detach();
+        xyWidget->setFrame(nullptr);
+    }
+    liveView.stop();
+}
+
+daq::FunctionBlockTypePtr QtXyFbImpl::CreateType()
+{
+    return daq::FunctionBlockType(
+        "opendaq_qt_xy",
+        "Qt XY Plot",
+        "One signal against another on their common domain, drawn as a fading persistence raster",
+        daq::PropertyObject()
+    );
+}
+
+void QtXyFbImpl::initProperties()
+{
+    auto onPropertyValueWrite = [this](daq::PropertyObjectPtr& obj, daq::PropertyValueEventArgsPtr& args)
+    {
+        propertyChanged(args.getProperty().getName(), args.getValue());
+    };
+
+    const auto autoRangeProp = daq::BoolProperty("AutoRange", autoRange);
+    objPtr.addProperty(autoRangeProp);
+    objPtr.getOnPropertyValueWrite("AutoRange") += onPropertyValueWrite;
+
+    // Value ranges without AutoRange
+    const auto xMinProp = daq::FloatProperty("XMin", xMin);
+    objPtr.addProperty(xMinProp);
+    objPtr.getOnPropertyValueWrite("XMin") += onPropertyValueWrite;
+
+    const auto xMaxProp = daq::FloatProperty("XMax", xMax);
+    objPtr.addProperty(xMaxProp);
+    objPtr.getOnPropertyValueWrite("XMax") += onPropertyValueWrite;
+
+    const auto yMinProp = daq::FloatProperty("YMin", yMin);
+    objPtr.addProperty(yMinProp);
+    objPtr.getOnPropertyValueWrite("YMin") += onPropertyValueWrite;
+
+    const auto yMaxProp = daq::FloatProperty("YMax", yMax);
+    objPtr.addProperty(yMaxProp);
+    objPtr.getOnPropertyValueWrite("YMax") += onPropertyValueWrite;
+
+    // Half-life of the hits; 0 keeps them until cleared
+    const auto persistenceProp = daq::FloatPropertyBuilder("Persistence", persistence)
+                                     .setMinValue(0.0)
+                                     .setSuggestedValues(daq::List<daq::Float>(0.0, 0.1, 1.0, 10.0))
+                                     .setUnit(daq::Unit("s", -1, "second", "time"))
+                                     .build();
+    objPtr.addProperty(persistenceProp);
+    objPtr.getOnPropertyValueWrite("Persistence") += onPropertyValueWrite;
+
+    const auto colorMapProp = daq::SelectionProperty(
+        "ColorMap", List<IString>("Jet", "Inferno", "Grayscale"), static_cast<Int>(colorMap));
+    objPtr.addProperty(colorMapProp);
+    objPtr.getOnPropertyValueWrite("ColorMap") += onPropertyValueWrite;
+
+    const auto maxFpsProp = daq::IntPropertyBuilder("MaxFps", 30)
+                                .setMinValue(1)
+                                .setMaxValue(240)
+                                .setSuggestedValues(daq::List<daq::Int>(10, 30, 60, 120))
+                                .build();
+    objPtr.addProperty(maxFpsProp);
+    objPtr.getOnPropertyValueWrite("MaxFps") += onPropertyValueWrite;
+}
+
+void QtXyFbImpl::propertyChanged(const StringPtr& propertyName, const BaseObjectPtr& value)
+{
+    auto lock = getRecursiveConfigLock();
+
+    if (propertyName == "AutoRange")
+    {
+        autoRange = value;
+        raster.setRange(0.0, 0.0, 0.0, 0.0);  // Fitted or taken from the properties on the next read
+    }
+    else if (propertyName == "XMin")
+        xMin = value;
+    else if (propertyName == "XMax")
+        xMax = value;
+    else if (propertyName == "YMin")
+        yMin = value;
+    else if (propertyName == "YMax")
+        yMax = value;
+    else if (propertyName == "Persistence")
+        persistence = value;
+    else if (propertyName == "ColorMap")
+    {
+        colorMap = static_cast<ColorMap>(value.asPtr<IInteger>(true));
+        colorTable = makeColorTable(colorMap);
+    }
+    else if (propertyName == "MaxFps")
+        liveView.setMaxFps(static_cast<int>(static_cast<Int>(value)));
+
+    liveView.invalidate();
+
+    LOG_W("Property {} changed to {}", propertyName, value.toString());
+}
+
+void QtXyFbImpl::onConnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    // The reader is opened by the acquisition thread once both ports are connected
+    pairReader.reset();
+    readerFailed = false;
+    liveView.invalidate();
+
+    LOG_W("Connected to port {}", inputPort.getLocalId());
+}
+
+void QtXyFbImpl::onDisconnected(const daq::InputPortPtr& inputPort)
+{
+    auto lock = this->getRecursiveConfigLock();
+
+    pairReader.reset();
+    readerFailed = false;
+    liveView.invalidate();
+
+    LOG_W("Disconnected from port {}", inputPort.getLocalId());
+}
+
+void QtXyFbImpl::onPacketReceived(const daq::InputPortPtr& /*port*/)
+{
+    liveView.packetReceived();
+}
+
+void QtXyFbImpl::acquire()
+{
+    auto lock = getRecursiveConfigLock();
+
+    const bool invalidated = liveView.takeInvalidated();
+    const bool cleared = clearRequested.exchange(false);
+    const bool visible = liveView.visible();
+
+    raster.resize(rasterWidth.load(), rasterHeight.load());
+    if (cleared)
+    {
+        raster.clear();
+        if (autoRange)
+            raster.setRange(0.0, 0.0, 0.0, 0.0);
+    }
+    if (!autoRange)
+        raster.setRange(xMin, xMax, yMin, yMax);
+
+    // Hits keep accumulating while hidden, so the view shows the recent history once it is shown again
+    applyDecay();
+    const size_t pairs = openReader() ? readPairs() : 0;
+
+    const bool fading = persistence > 0.0 && !raster.empty();
+    if (!visible || !(pairs > 0 || fading || invalidated || cleared))
+        return;
+
+    XyFrame& frame = frameBuffer.writeBuffer();
+    frame.width = raster.width();
+    frame.height = raster.height();
+    frame.pixels.resize(static_cast<size_t>(frame.width) * static_cast<size_t>(frame.height));
+    raster.render(colorTable, frame.pixels.data());
+    frame.xMin = raster.minX();
+    frame.xMax = raster.maxX();
+    frame.yMin = raster.minY();
+    frame.yMax = raster.maxY();
+    frame.xCaption = xCaption;
+    frame.yCaption = yCaption;
+
+    frameBuffer.publish();
+    liveView.frameReady();
+}
+
+bool QtXyFbImpl::openReader()
+{
+    if (pairReader)
+        return true;
+    if (readerFailed || !xPort.getSignal().assigned() || !yPort.getSignal().assigned())
+        return false;
+
+    try
+    {
+        pairReader = std::make_unique<BatchReader>(
+            std::vector<daq::InputPortPtr>{xPort, yPort}, daq::SampleType::Float64, daq::SampleType::Int64, [this]()
+            {
+                liveView.packetReceived();
+            });
+    }
+    catch (const std::exception& e)
+    {
+        readerFailed = true;
+        LOG_W("X and Y cannot be read on a common domain: {}", e.what())
+        return false;
+    }
+
+    // Earlier hits belong to other signals
+    raster.clear();
+    if (autoRange)
+        raster.setRange(0.0, 0.0, 0.0, 0.0);
+    return true;
+}
+
+size_t QtXyFbImpl::readPairs()
+{
+    // A read stops at an event; the pairs behind it are read right away, not on the next wake-up
+    size_t accumulated = 0;
+    while (pairReader)
+    {
+        size_t count = 0;
+        try
+        {
+            count = pairReader->read();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_W("Error reading data from MultiReader: {}", e.what())
+            pairReader.reset();
+            readerFailed = true;
+            break;
+        }
+
+        const auto* x = static_cast<const double*>(pairReader->values(0));
+        const auto* y = static_cast<const double*>(pairReader->values(1));
+        if (autoRange)
+            fitRange(x, y, count);
+        accumulated += raster.accumulate(x, y, count);
+
+        if (!pairReader->hasEvent())
+            break;
+        handleEvents();
+    }
+    return accumulated;
+}
+
+void QtXyFbImpl::handleEvents()
+{
+    for (const auto& port : {xPort, yPort})
+    {
+        const auto eventPacket = pairReader->eventFor(port);
+        if (eventPacket.assigned() && eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+            (port == xPort ? xCaption : yCaption) = captionOf(port, eventPacket);
+    }
+
+    // Descriptors the ports can no longer be aligned with: reopen the reader
+    if (!pairReader->isValid())
+    {
+        pairReader.reset();
+        LOG_W("Descriptors of X and Y changed, reopening their reader")
+    }
+    liveView.invalidate();
+}
+
+void QtXyFbImpl::fitRange(const double* x, const double* y, size_t count)
+{
+    double xLow, xHigh, yLow, yHigh;
+    if (!finiteRange(x, count, xLow, xHigh) || !finiteRange(y, count, yLow, yHigh))
+        return;
+
+    double newXMin = raster.minX();
+    double newXMax = raster.maxX();
+    double newYMin = raster.minY();
+    double newYMax = raster.maxY();
+    const bool xChanged = fitAxis(xLow, xHigh, newXMin, newXMax);
+    const bool yChanged = fitAxis(yLow, yHigh, newYMin, newYMax);
+    if (xChanged || yChanged)
+        raster.setRange(newXMin, newXMax, newYMin, newYMax);
+}
+
+void QtXyFbImpl::applyDecay()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double>(now - lastDecay).count();
+    lastDecay = now;
+
+    if (persistence > 0.0)
+        raster.decay(std::exp2(-elapsed / persistence));
+}
+
+ErrCode QtXyFbImpl::getWidget(struct QWidget** widget)
+{
+    if (widget == nullptr)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    // Recreate widget if it was deleted by parent
+    if (!embeddedWidget)
+        createWidget();
+
+    if (!embeddedWidget)
+        return OPENDAQ_ERR_NOTFOUND;
+
+    *widget = embeddedWidget;
+    return OPENDAQ_SUCCESS;
+}
+
+void QtXyFbImpl::createWidget()
+{
+    auto* widget = new QWidget();
+    auto* layout = new QVBoxLayout(widget);
+    layout->setContentsMargins(0, 0, 0, 0);
+
+    auto* toolbarWidget = new QWidget(widget);
+    auto* toolbarLayout = new QHBoxLayout(toolbarWidget);
+    toolbarLayout->setContentsMargins(5, 5, 5, 5);
+
+    auto* freezeBtn = new QPushButton("Freeze", toolbarWidget);
+    freezeBtn->setToolTip("Freeze/Unfreeze XY updates");
+    freezeBtn->setCheckable(true);
+    freezeBtn->setMaximumWidth(70);
+
+    auto* clearBtn = new QPushButton("Clear", toolbarWidget);
+    clearBtn->setToolTip("Clear the persistence, and the range with AutoRange");
+    clearBtn->setMaximumWidth(70);
+
+    toolbarLayout->addWidget(freezeBtn);
+    toolbarLayout->addWidget(clearBtn);
+    toolbarLayout->addStretch();
+    layout->addWidget(toolbarWidget);
+
+    QObject::connect(freezeBtn, &QPushButton::toggled, [this, freezeBtn](bool checked)
+    {
+        this->setActive(!checked);
+        if (checked)
+        {
+            freezeBtn->setText("Unfreeze");
+            freezeBtn->setStyleSheet("background-color: #ff6b6b; color: white;");
+        }
+        else
+        {
+            freezeBtn->setText("Freeze");
+            freezeBtn->setStyleSheet("");
+        }
+    });
+
+    QObject::connect(clearBtn, &QPushButton::clicked, [this]()
+    {
+        // The raster belongs to the acquisition thread, which clears it before its next frame
+        clearRequested = true;
+        liveView.wake();
+    });
+
+    // One raster cell per pixel of the plot area; a new size starts the raster over
+    auto* view = new XyWidget([this](int width, int height)
+    {
+        rasterHeight = height;
+        rasterWidth = width;
+        liveView.invalidate();
+    }, widget);
+    layout->addWidget(view);
+
+    embeddedWidget = widget;
+    xyWidget = view;
+    liveView.attach(embeddedWidget);
+}
+
+void QtXyFbImpl::updatePlot()
+{
+    if (!xyWidget)
+        return;
+
+    // Only swap in the latest raster; pairing and accumulation happen on the acquisition thread
+    if (!frameBuffer.update())
+        return;
+
+    xyWidget->setFrame(&frameBuffer.readBuffer());
+    xyWidget->update();
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,208 @@
+#include <opendaq_qt_module/raster_series_item.h>
+#include <QPainter>
+#include <QWidget>
+#include <QtCharts/QChart>
+#include <QtCharts/QDateTimeAxis>
+#include <QtCharts/QValueAxis>
+#include <algorithm>
+#include <cmath>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+// Same layer as the chart's own series, below legend and marker labels
+constexpr qreal RasterZValue = 5.0;
+
+// Chart value -> pixel in the cached raster
+struct PixelMapping
+{
+    double xMin;
+    double xScale;
+    double yMin;
+    double yScale;
+    double height;
+
+    QPointF map(const QPointF& point) const
+    {
+        return QPointF((point.x() - xMin) * xScale, height - (point.y() - yMin) * yScale);
+    }
+};
+
+void buildPolyline(const QVector<QPointF>& points, const PixelMapping& mapping, qreal width, QPolygonF& polyline)
+{
+    polyline.resize(0);
+    if (points.isEmpty())
+        return;
+
+    // Sparse: every point is a vertex
+    if (points.size() <= width * 2)
+    {
+        polyline.reserve(points.size());
+        for (const auto& point : points)
+            polyline.append(mapping.map(point));
+        return;
+    }
+
+    // Dense: entry, min, max and last of each pixel column
+    QPointF first = mapping.map(points[0]);
+    double column = std::floor(first.x());
+    qreal entry = first.y();
+    qreal low = entry;
+    qreal high = entry;
+    qreal last = entry;
+
+    auto flushColumn = [&]()
+    {
+        const qreal x = column + 0.5;
+        polyline.append(QPointF(x, entry));
+        if (high > low)
+        {
+            polyline.append(QPointF(x, low));
+            polyline.append(QPointF(x, high));
+        }
+        polyline.append(QPointF(x, last));
+    };
+
+    for (int i = 1; i < points.size(); ++i)
+    {
+        const QPointF pixel = mapping.map(points[i]);
+        const double pixelColumn = std::floor(pixel.x());
+        if (pixelColumn != column)
+        {
+            flushColumn();
+            column = pixelColumn;
+            entry = low = high = last = pixel.y();
+            continue;
+        }
+
+        low = std::min(low, pixel.y());
+        high = std::max(high, pixel.y());
+        last = pixel.y();
+    }
+    flushColumn();
+}
+
+}  // namespace
+
+RasterSeriesItem::RasterSeriesItem(QChart* chart, QDateTimeAxis* axisX, QValueAxis* axisY)
+    : QGraphicsObject(chart)
+    , chart(chart)
+    , axisX(axisX)
+    , axisY(axisY)
+{
+    setZValue(RasterZValue);
+    setAcceptedMouseButtons(Qt::NoButton);
+
+    // The cached raster is only valid for one plot area and axis range
+    QObject::connect(chart, &QChart::plotAreaChanged, this, [this](const QRectF&)
+    {
+        prepareGeometryChange();
+        invalidate();
+    });
+    if (axisX)
+        QObject::connect(axisX, &QDateTimeAxis::rangeChanged, this, [this]() { invalidate(); });
+    if (axisY)
+        QObject::connect(axisY, &QValueAxis::rangeChanged, this, [this]() { invalidate(); });
+}
+
+void RasterSeriesItem::setSignal(quint64 signalId, const QVector<QPointF>& points, const QPen& pen, bool visible)
+{
+    Layer& layer = layers[signalId];
+    layer.points = points;
+    layer.pen = pen;
+    layer.visible = visible;
+    invalidate();
+}
+
+void RasterSeriesItem::removeSignal(quint64 signalId)
+{
+    if (layers.erase(signalId) > 0)
+        invalidate();
+}
+
+void RasterSeriesItem::clearSignals()
+{
+    layers.clear();
+    invalidate();
+}
+
+QRectF RasterSeriesItem::boundingRect() const
+{
+    if (!chart)
+        return QRectF();
+    return chart->plotArea();
+}
+
+void RasterSeriesItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* /*option*/, QWidget* widget)
+{
+    if (!chart)
+        return;
+
+    const QRectF area = chart->plotArea();
+    const qreal devicePixelRatio = widget ? widget->devicePixelRatioF() : 1.0;
+    if (area != plotArea || cache.devicePixelRatio() != devicePixelRatio)
+    {
+        plotArea = area;
+        cacheValid = false;
+    }
+
+    if (!cacheValid)
+        render(devicePixelRatio);
+
+    painter->drawImage(plotArea.topLeft(), cache);
+}
+
+void RasterSeriesItem::invalidate()
+{
+    cacheValid = false;
+    update();
+}
+
+void RasterSeriesItem::render(qreal devicePixelRatio)
+{
+    cacheValid = true;
+
+    const QSize pixelSize = (plotArea.size() * devicePixelRatio).toSize();
+    if (cache.size() != pixelSize)
+        cache = QImage(pixelSize, QImage::Format_ARGB32_Premultiplied);
+    cache.setDevicePixelRatio(devicePixelRatio);
+    cache.fill(Qt::transparent);
+
+    if (!axisX || !axisY || layers.empty() || pixelSize.isEmpty())
+        return;
+
+    const double xMin = static_cast<double>(axisX->min().toMSecsSinceEpoch());
+    const double xRange = static_cast<double>(axisX->max().toMSecsSinceEpoch()) - xMin;
+    const double yMin = axisY->min();
+    const double yRange = axisY->max() - yMin;
+    if (xRange <= 0.0 || yRange <= 0.0)
+        return;
+
+    PixelMapping mapping;
+    mapping.xMin = xMin;
+    mapping.xScale = plotArea.width() / xRange;
+    mapping.yMin = yMin;
+    mapping.yScale = plotArea.height() / yRange;
+    mapping.height = plotArea.height();
+
+    QPainter painter(&cache);
+    painter.setRenderHint(QPainter::Antialiasing);
+    for (const auto& [signalId, layer] : layers)
+    {
+        if (!layer.visible || layer.points.isEmpty())
+            continue;
+
+        buildPolyline(layer.points, mapping, plotArea.width(), polyline);
+        painter.setPen(layer.pen);
+        painter.drawPolyline(polyline);
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
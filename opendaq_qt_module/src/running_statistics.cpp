@@ -0,0 +1,337 @@
+#include <opendaq_qt_module/running_statistics.h>
+#include <algorithm>
+#include <cmath>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr int64_t ChunksPerWindow = 16;
+constexpr size_t MaxSlice = 8192;       // Samples per kernel call: the second pass finds them in cache
+constexpr int MaxBins = 4096;
+constexpr double RangeMargin = 0.1;     // Auto range: fraction of the span added on each side
+constexpr double RangeGrowth = 0.25;    // Extra room when the range has to grow, so drift does not restart the histograms every read
+
+}  // namespace
+
+void KahanSum::add(double value)
+{
+    // Neumaier's variant: also exact when the new term is larger than the sum
+    const double next = sum + value;
+    if (std::abs(sum) >= std::abs(value))
+        compensation += (sum - next) + value;
+    else
+        compensation += (value - next) + sum;
+    sum = next;
+}
+
+void KahanSum::add(const KahanSum& other)
+{
+    add(other.sum);
+    add(other.compensation);
+}
+
+void Moments::add(const Kernels::BlockMoments& block)
+{
+    if (block.count <= 0)
+        return;
+
+    Moments moments;
+    moments.count = static_cast<uint64_t>(block.count);
+    moments.min = block.min;
+    moments.max = block.max;
+    moments.mean = block.sum / block.count;
+    moments.m2 = block.m2;
+    moments.sumSquares.add(block.sumSquares);
+    merge(moments);
+}
+
+void Moments::merge(const Moments& other)
+{
+    if (other.count == 0)
+        return;
+    if (count == 0)
+    {
+        *this = other;
+        return;
+    }
+
+    // Chan et al.: mean and M2 of the union from those of the parts
+    const double countA = static_cast<double>(count);
+    const double countB = static_cast<double>(other.count);
+    const double merged = countA + countB;
+    const double delta = other.mean - mean;
+    mean += delta * (countB / merged);
+    m2 += other.m2 + delta * delta * (countA * countB / merged);
+
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sumSquares.add(other.sumSquares);
+    count += other.count;
+}
+
+void RunningStatistics::configure(const StatisticsSettings& newSettings)
+{
+    StatisticsSettings normalized = newSettings;
+    normalized.window = std::max(normalized.window, 1e-3);
+    normalized.bins = std::clamp(normalized.bins, 1, MaxBins);
+    if (normalized == settings && !totalHistogram.empty())
+        return;
+
+    settings = normalized;
+    updateWindow();
+    reset();
+}
+
+void RunningStatistics::setDomain(double secondsPerTick, int64_t linearDelta)
+{
+    tickSeconds = secondsPerTick;
+    tickDelta = linearDelta;
+    updateWindow();
+    reset();
+}
+
+void RunningStatistics::updateWindow()
+{
+    windowTicks = tickSeconds > 0.0 ? std::max<int64_t>(std::llround(settings.window / tickSeconds), 1) : 0;
+    chunkTicks = std::max<int64_t>(windowTicks / ChunksPerWindow, windowTicks > 0 ? 1 : 0);
+}
+
+void RunningStatistics::reset()
+{
+    total = {};
+    hasTicks = false;
+    firstTick = 0;
+    lastTick = 0;
+    totalDropped = 0;
+    current = {};
+    chunks.clear();
+
+    rangeMin = settings.autoRange ? 0.0 : settings.histogramMin;
+    rangeMax = settings.autoRange ? 0.0 : settings.histogramMax;
+    clearHistograms();
+}
+
+void RunningStatistics::clearHistograms()
+{
+    const size_t bins = static_cast<size_t>(settings.bins);
+    binScale = rangeMax > rangeMin ? settings.bins / (rangeMax - rangeMin) : 0.0;
+    totalHistogram.assign(bins, 0);
+    current.histogram.assign(bins, 0);
+    for (Chunk& chunk : chunks)
+        chunk.histogram.assign(bins, 0);
+}
+
+void RunningStatistics::add(const double* values, const int64_t* ticks, size_t count)
+{
+    if (count == 0)
+        return;
+
+    countDropped(ticks, count);
+
+    // Split at chunk boundaries; ticks are ascending, so each boundary is a binary search away
+    size_t pos = 0;
+    while (pos < count)
+    {
+        size_t end = count;
+        if (chunkTicks > 0 && current.started)
+            end = static_cast<size_t>(std::lower_bound(ticks + pos, ticks + count, current.firstTick + chunkTicks) - ticks);
+
+        if (end == pos)
+        {
+            closeChunk();
+            continue;
+        }
+
+        addPiece(values + pos, ticks + pos, end - pos);
+        pos = end;
+    }
+
+    // Chunks entirely older than the window leave it
+    while (windowTicks > 0 && !chunks.empty() && chunks.front().lastTick <= lastTick - windowTicks)
+    {
+        spareHistogram = std::move(chunks.front().histogram);
+        chunks.pop_front();
+    }
+}
+
+void RunningStatistics::addPiece(const double* values, const int64_t* ticks, size_t count)
+{
+    if (!current.started)
+    {
+        current.started = true;
+        current.firstTick = ticks[0];
+    }
+    current.lastTick = ticks[count - 1];
+
+    if (!hasTicks)
+    {
+        hasTicks = true;
+        firstTick = ticks[0];
+    }
+    lastTick = ticks[count - 1];
+
+    for (size_t begin = 0; begin < count; begin += MaxSlice)
+    {
+        const size_t sliceCount = std::min(MaxSlice, count - begin);
+        const double* slice = values + begin;
+
+        Kernels::BlockMoments block;
+        Kernels::blockMoments(slice, static_cast<int>(sliceCount), block);
+        if (block.count == 0)
+            continue;
+
+        if (settings.autoRange)
+            fitRange(block.min, block.max);
+        current.moments.add(block);
+        total.add(block);
+
+        // Counted into the chunk only; the cumulative histogram takes the chunk over when it closes
+        if (binScale <= 0.0)
+            continue;
+        const double bins = static_cast<double>(settings.bins);
+        for (size_t i = 0; i < sliceCount; ++i)
+        {
+            // Also false for NaN
+            const double position = (slice[i] - rangeMin) * binScale;
+            if (position >= 0.0 && position < bins)
+                ++current.histogram[static_cast<size_t>(position)];
+        }
+    }
+}
+
+void RunningStatistics::countDropped(const int64_t* ticks, size_t count)
+{
+    if (tickDelta <= 0)
+        return;
+
+    uint64_t dropped = 0;
+    if (hasTicks && ticks[0] - lastTick > tickDelta)
+        dropped += static_cast<uint64_t>((ticks[0] - lastTick) / tickDelta - 1);
+
+    // Without a gap the block spans exactly count - 1 deltas; only then look for where it is
+    if (ticks[count - 1] - ticks[0] != static_cast<int64_t>(count - 1) * tickDelta)
+    {
+        for (size_t i = 1; i < count; ++i)
+        {
+            const int64_t step = ticks[i] - ticks[i - 1];
+            if (step > tickDelta)
+                dropped += static_cast<uint64_t>(step / tickDelta - 1);
+        }
+    }
+
+    current.dropped += dropped;
+    totalDropped += dropped;
+}
+
+void RunningStatistics::fitRange(double low, double high)
+{
+    if (!std::isfinite(low) || !std::isfinite(high))
+        return;
+    if (rangeMax > rangeMin && low >= rangeMin && high <= rangeMax)
+        return;
+
+    if (rangeMax > rangeMin)
+    {
+        const double growth = (std::max(high, rangeMax) - std::min(low, rangeMin)) * RangeGrowth;
+        if (low < rangeMin)
+            rangeMin = low - growth;
+        if (high > rangeMax)
+            rangeMax = high + growth;
+    }
+    else
+    {
+        const double span = high - low;
+        const double margin = span > 0.0 ? span * RangeMargin : std::max(std::abs(low) * RangeMargin, 1.0);
+        rangeMin = low - margin;
+        rangeMax = high + margin;
+    }
+
+    // Bins of another range cannot be carried over
+    clearHistograms();
+}
+
+void RunningStatistics::closeChunk()
+{
+    if (!current.started)
+        return;
+
+    for (size_t bin = 0; bin < totalHistogram.size(); ++bin)
+        totalHistogram[bin] += current.histogram[bin];
+
+    chunks.push_back(std::move(current));
+    current = {};
+    current.histogram = std::move(spareHistogram);
+    current.histogram.assign(static_cast<size_t>(settings.bins), 0);
+    spareHistogram = {};
+}
+
+StatisticsSnapshot RunningStatistics::cumulative() const
+{
+    return snapshot(total, firstTick, lastTick, totalDropped);
+}
+
+StatisticsSnapshot RunningStatistics::sliding() const
+{
+    Moments moments;
+    uint64_t dropped = 0;
+    for (const Chunk& chunk : chunks)
+    {
+        moments.merge(chunk.moments);
+        dropped += chunk.dropped;
+    }
+    moments.merge(current.moments);
+    dropped += current.dropped;
+
+    const int64_t first = chunks.empty() ? current.firstTick : chunks.front().firstTick;
+    return snapshot(moments, first, lastTick, dropped);
+}
+
+StatisticsSnapshot RunningStatistics::snapshot(const Moments& moments, int64_t first, int64_t last, uint64_t dropped) const
+{
+    StatisticsSnapshot result;
+    result.count = moments.count;
+    result.dropped = dropped;
+    if (moments.count == 0)
+        return result;
+
+    const double count = static_cast<double>(moments.count);
+    result.min = moments.min;
+    result.max = moments.max;
+    result.mean = moments.mean;
+    result.stdDev = moments.count > 1 ? std::sqrt(std::max(moments.m2, 0.0) / (count - 1.0)) : 0.0;
+    result.rms = std::sqrt(std::max(moments.sumSquares.value(), 0.0) / count);
+    if (tickSeconds > 0.0 && last > first && moments.count > 1)
+        result.sampleRate = (count - 1.0) / (static_cast<double>(last - first) * tickSeconds);
+    return result;
+}
+
+bool RunningStatistics::histogram(bool slidingWindow, std::vector<uint64_t>& counts) const
+{
+    if (binScale <= 0.0)
+        return false;
+
+    counts.assign(current.histogram.begin(), current.histogram.end());
+    auto addCounts = [&counts](const std::vector<uint64_t>& histogram)
+    {
+        for (size_t bin = 0; bin < counts.size() && bin < histogram.size(); ++bin)
+            counts[bin] += histogram[bin];
+    };
+
+    if (slidingWindow)
+    {
+        for (const Chunk& chunk : chunks)
+            addCounts(chunk.histogram);
+    }
+    else
+        addCounts(totalHistogram);
+    return true;
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,98 @@
+#include <opendaq_qt_module/signal_path.h>
+#include <cstdint>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+template <typename DomainT>
+std::unique_ptr<ISignalPath> createForDomain(daq::SampleType valueType, daq::SampleType domainType)
+{
+    switch (valueType)
+    {
+        case daq::SampleType::Float32:
+            return std::make_unique<NativeSignalPath<float, DomainT>>(valueType, domainType);
+        case daq::SampleType::Int8:
+            return std::make_unique<NativeSignalPath<int8_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::UInt8:
+            return std::make_unique<NativeSignalPath<uint8_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::Int16:
+            return std::make_unique<NativeSignalPath<int16_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::UInt16:
+            return std::make_unique<NativeSignalPath<uint16_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::Int32:
+            return std::make_unique<NativeSignalPath<int32_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::UInt32:
+            return std::make_unique<NativeSignalPath<uint32_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::Int64:
+            return std::make_unique<NativeSignalPath<int64_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::UInt64:
+            return std::make_unique<NativeSignalPath<uint64_t, DomainT>>(valueType, domainType);
+        case daq::SampleType::Float64:
+        default:
+            return std::make_unique<NativeSignalPath<double, DomainT>>(daq::SampleType::Float64, domainType);
+    }
+}
+
+}  // namespace
+
+daq::SampleType nativeReadValueType(daq::SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case daq::SampleType::Float32:
+        case daq::SampleType::Float64:
+        case daq::SampleType::Int8:
+        case daq::SampleType::UInt8:
+        case daq::SampleType::Int16:
+        case daq::SampleType::UInt16:
+        case daq::SampleType::Int32:
+        case daq::SampleType::UInt32:
+        case daq::SampleType::Int64:
+        case daq::SampleType::UInt64:
+            return sampleType;
+        default:
+            return daq::SampleType::Float64;
+    }
+}
+
+daq::SampleType nativeReadDomainType(daq::SampleType sampleType)
+{
+    // Narrower integer domains are widened by the reader
+    if (sampleType == daq::SampleType::UInt64)
+        return daq::SampleType::UInt64;
+    return daq::SampleType::Int64;
+}
+
+daq::SampleType scaledReadValueType(daq::SampleType rawType, daq::ScaledSampleType outputType)
+{
+    if (outputType == daq::ScaledSampleType::Float32)
+        return daq::SampleType::Float32;
+
+    // Float32 has a 24-bit mantissa, so scaled 8/16-bit samples lose nothing that was measured
+    switch (rawType)
+    {
+        case daq::SampleType::Int8:
+        case daq::SampleType::UInt8:
+        case daq::SampleType::Int16:
+        case daq::SampleType::UInt16:
+            return daq::SampleType::Float32;
+        default:
+            return daq::SampleType::Float64;
+    }
+}
+
+std::unique_ptr<ISignalPath> createSignalPath(daq::SampleType valueType, daq::SampleType domainType)
+{
+    if (domainType == daq::SampleType::UInt64)
+        return createForDomain<uint64_t>(valueType, domainType);
+    return createForDomain<int64_t>(valueType, daq::SampleType::Int64);
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
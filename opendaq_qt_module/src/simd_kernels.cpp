@@ -0,0 +1,752 @@
+#include <opendaq_qt_module/simd_kernels.h>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define QT_MODULE_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(QT_MODULE_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define QT_MODULE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define QT_MODULE_TARGET_AVX2
+#endif
+
+// This file must be compiled without floating-point contraction (no FMA), otherwise
+// the scalar and vector versions could round the triangle areas differently.
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace Kernels
+{
+
+namespace
+{
+
+// Scalar reference versions
+
+void minMaxIndexScalar(const double* values, int count, int& minIdx, int& maxIdx)
+{
+    double minVal = values[0];
+    double maxVal = values[0];
+    minIdx = 0;
+    maxIdx = 0;
+
+    for (int i = 1; i < count; ++i)
+    {
+        const double value = values[i];
+        if (value < minVal) { minVal = value; minIdx = i; }
+        if (value > maxVal) { maxVal = value; maxIdx = i; }
+    }
+}
+
+int largestTriangleIndexScalar(const double* times, const double* values, int count,
+                               double timeA, double valA, double avgX, double avgY)
+{
+    const double dxAvg = avgX - timeA;
+    const double dyAvg = avgY - valA;
+
+    double maxArea = -1.0;
+    int maxAreaIdx = 0;
+    for (int j = 0; j < count; ++j)
+    {
+        const double area = std::abs(dxAvg * (values[j] - valA) - (times[j] - timeA) * dyAvg);
+        if (area > maxArea)
+        {
+            maxArea = area;
+            maxAreaIdx = j;
+        }
+    }
+    return maxAreaIdx;
+}
+
+bool crossesAt(const double* values, int i, double level, Crossing crossing)
+{
+    switch (crossing)
+    {
+        case Crossing::Rising:
+            return values[i - 1] < level && values[i] >= level;
+        case Crossing::Falling:
+            return values[i - 1] > level && values[i] <= level;
+        case Crossing::Above:
+        default:
+            return values[i] >= level;
+    }
+}
+
+int firstCrossingFrom(const double* values, int begin, int count, double level, Crossing crossing)
+{
+    for (int i = begin; i < count; ++i)
+    {
+        if (crossesAt(values, i, level, crossing))
+            return i;
+    }
+    return count;
+}
+
+#if !defined(QT_MODULE_X86_SIMD)
+// x86 always has SSE2, so the SIMD versions replace this one there
+int firstCrossingScalar(const double* values, int count, double level, Crossing crossing)
+{
+    return firstCrossingFrom(values, crossing == Crossing::Above ? 0 : 1, count, level, crossing);
+}
+#endif
+
+constexpr int MomentLanes = 4;
+
+double combineLanes(const double* lanes)
+{
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+// Adds values[begin, count) to the lanes, value i to lane i % MomentLanes
+void addMoments(const double* values, int begin, int count,
+                double* numbers, double* sums, double* squares, double& minVal, double& maxVal)
+{
+    for (int i = begin; i < count; ++i)
+    {
+        const double value = values[i];
+        if (std::isnan(value))
+            continue;
+
+        const int lane = i % MomentLanes;
+        numbers[lane] += 1.0;
+        sums[lane] += value;
+        squares[lane] += value * value;
+        if (value < minVal) minVal = value;
+        if (value > maxVal) maxVal = value;
+    }
+}
+
+void addDeviations(const double* values, int begin, int count, double mean, double* deviations)
+{
+    for (int i = begin; i < count; ++i)
+    {
+        if (std::isnan(values[i]))
+            continue;
+
+        const double deviation = values[i] - mean;
+        deviations[i % MomentLanes] += deviation * deviation;
+    }
+}
+
+void storeMoments(const double* numbers, const double* sums, const double* squares,
+                  double minVal, double maxVal, BlockMoments& moments)
+{
+    moments.count = static_cast<int>(combineLanes(numbers));
+    moments.min = minVal;
+    moments.max = maxVal;
+    moments.sum = combineLanes(sums);
+    moments.sumSquares = combineLanes(squares);
+    moments.m2 = 0.0;
+}
+
+#if !defined(QT_MODULE_X86_SIMD)
+void blockMomentsScalar(const double* values, int count, BlockMoments& moments)
+{
+    double numbers[MomentLanes] = {};
+    double sums[MomentLanes] = {};
+    double squares[MomentLanes] = {};
+    double minVal = HUGE_VAL;
+    double maxVal = -HUGE_VAL;
+    addMoments(values, 0, count, numbers, sums, squares, minVal, maxVal);
+    storeMoments(numbers, sums, squares, minVal, maxVal, moments);
+    if (moments.count == 0)
+        return;
+
+    // Second pass around the block mean: no cancellation, unlike sumSquares - sum^2 / count
+    double deviations[MomentLanes] = {};
+    addDeviations(values, 0, count, moments.sum / moments.count, deviations);
+    moments.m2 = combineLanes(deviations);
+}
+#endif
+
+#if defined(QT_MODULE_X86_SIMD)
+
+// Lowest set bit of a movemask result (mask != 0)
+int firstLane(int mask)
+{
+    int lane = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        ++lane;
+    }
+    return lane;
+}
+
+// Reduce per-lane (area, index) candidates: largest area, earliest index on ties
+void reduceLanes(const double* best, const double* bestIdx, int lanes, double& maxArea, int& maxAreaIdx)
+{
+    maxArea = best[0];
+    double idx = bestIdx[0];
+    for (int lane = 1; lane < lanes; ++lane)
+    {
+        if (best[lane] > maxArea || (best[lane] == maxArea && bestIdx[lane] < idx))
+        {
+            maxArea = best[lane];
+            idx = bestIdx[lane];
+        }
+    }
+    maxAreaIdx = static_cast<int>(idx);
+}
+
+// SSE2 (baseline on x86-64)
+
+void minMaxIndexSse2(const double* values, int count, int& minIdx, int& maxIdx)
+{
+    if (count < 8)
+    {
+        minMaxIndexScalar(values, count, minIdx, maxIdx);
+        return;
+    }
+
+    // Pass 1: minimum and maximum value
+    __m128d vMin = _mm_loadu_pd(values);
+    __m128d vMax = vMin;
+    __m128d vNaN = _mm_cmpunord_pd(vMin, vMin);
+    int i = 2;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128d v = _mm_loadu_pd(values + i);
+        vMin = _mm_min_pd(vMin, v);
+        vMax = _mm_max_pd(vMax, v);
+        vNaN = _mm_or_pd(vNaN, _mm_cmpunord_pd(v, v));
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, vMin);
+    double minVal = lanes[1] < lanes[0] ? lanes[1] : lanes[0];
+    _mm_storeu_pd(lanes, vMax);
+    double maxVal = lanes[1] > lanes[0] ? lanes[1] : lanes[0];
+    bool hasNaN = _mm_movemask_pd(vNaN) != 0;
+    for (; i < count; ++i)
+    {
+        hasNaN = hasNaN || std::isnan(values[i]);
+        if (values[i] < minVal) minVal = values[i];
+        if (values[i] > maxVal) maxVal = values[i];
+    }
+
+    // The min/max instructions order NaN differently from the scalar compares
+    if (hasNaN)
+    {
+        minMaxIndexScalar(values, count, minIdx, maxIdx);
+        return;
+    }
+
+    // Pass 2: the scalar loop keeps the first index holding each extreme
+    minIdx = -1;
+    maxIdx = -1;
+    const __m128d vMinVal = _mm_set1_pd(minVal);
+    const __m128d vMaxVal = _mm_set1_pd(maxVal);
+    int j = 0;
+    for (; j + 2 <= count && (minIdx < 0 || maxIdx < 0); j += 2)
+    {
+        const __m128d v = _mm_loadu_pd(values + j);
+        if (minIdx < 0)
+        {
+            const int mask = _mm_movemask_pd(_mm_cmpeq_pd(v, vMinVal));
+            if (mask != 0)
+                minIdx = j + firstLane(mask);
+        }
+        if (maxIdx < 0)
+        {
+            const int mask = _mm_movemask_pd(_mm_cmpeq_pd(v, vMaxVal));
+            if (mask != 0)
+                maxIdx = j + firstLane(mask);
+        }
+    }
+    for (; j < count && (minIdx < 0 || maxIdx < 0); ++j)
+    {
+        if (minIdx < 0 && values[j] == minVal) minIdx = j;
+        if (maxIdx < 0 && values[j] == maxVal) maxIdx = j;
+    }
+}
+
+int largestTriangleIndexSse2(const double* times, const double* values, int count,
+                             double timeA, double valA, double avgX, double avgY)
+{
+    if (count < 4)
+        return largestTriangleIndexScalar(times, values, count, timeA, valA, avgX, avgY);
+
+    const double dxAvg = avgX - timeA;
+    const double dyAvg = avgY - valA;
+    const __m128d vDxAvg = _mm_set1_pd(dxAvg);
+    const __m128d vDyAvg = _mm_set1_pd(dyAvg);
+    const __m128d vTimeA = _mm_set1_pd(timeA);
+    const __m128d vValA = _mm_set1_pd(valA);
+    const __m128d signMask = _mm_set1_pd(-0.0);
+    const __m128d vStep = _mm_set1_pd(2.0);
+
+    __m128d vBest = _mm_set1_pd(-1.0);
+    __m128d vBestIdx = _mm_setzero_pd();
+    __m128d vIdx = _mm_set_pd(1.0, 0.0);
+
+    int j = 0;
+    for (; j + 2 <= count; j += 2)
+    {
+        const __m128d t = _mm_loadu_pd(times + j);
+        const __m128d v = _mm_loadu_pd(values + j);
+        const __m128d cross = _mm_sub_pd(_mm_mul_pd(vDxAvg, _mm_sub_pd(v, vValA)),
+                                         _mm_mul_pd(_mm_sub_pd(t, vTimeA), vDyAvg));
+        const __m128d area = _mm_andnot_pd(signMask, cross);
+
+        // Strict compare per lane keeps the earliest index, like the scalar loop
+        const __m128d greater = _mm_cmpgt_pd(area, vBest);
+        vBest = _mm_or_pd(_mm_and_pd(greater, area), _mm_andnot_pd(greater, vBest));
+        vBestIdx = _mm_or_pd(_mm_and_pd(greater, vIdx), _mm_andnot_pd(greater, vBestIdx));
+        vIdx = _mm_add_pd(vIdx, vStep);
+    }
+
+    double best[2];
+    double bestIdx[2];
+    _mm_storeu_pd(best, vBest);
+    _mm_storeu_pd(bestIdx, vBestIdx);
+
+    double maxArea;
+    int maxAreaIdx;
+    reduceLanes(best, bestIdx, 2, maxArea, maxAreaIdx);
+
+    for (; j < count; ++j)
+    {
+        const double area = std::abs(dxAvg * (values[j] - valA) - (times[j] - timeA) * dyAvg);
+        if (area > maxArea)
+        {
+            maxArea = area;
+            maxAreaIdx = j;
+        }
+    }
+    return maxAreaIdx;
+}
+
+// Ordered compares are false for NaN, like the scalar ones
+template <Crossing C>
+int firstCrossingSse2(const double* values, int count, double level)
+{
+    const __m128d vLevel = _mm_set1_pd(level);
+    int i = C == Crossing::Above ? 0 : 1;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128d v = _mm_loadu_pd(values + i);
+        __m128d hit;
+        if constexpr (C == Crossing::Rising)
+            hit = _mm_and_pd(_mm_cmplt_pd(_mm_loadu_pd(values + i - 1), vLevel), _mm_cmpge_pd(v, vLevel));
+        else if constexpr (C == Crossing::Falling)
+            hit = _mm_and_pd(_mm_cmpgt_pd(_mm_loadu_pd(values + i - 1), vLevel), _mm_cmple_pd(v, vLevel));
+        else
+            hit = _mm_cmpge_pd(v, vLevel);
+
+        const int mask = _mm_movemask_pd(hit);
+        if (mask != 0)
+            return i + firstLane(mask);
+    }
+    return firstCrossingFrom(values, i, count, level, C);
+}
+
+int firstCrossingSse2(const double* values, int count, double level, Crossing crossing)
+{
+    switch (crossing)
+    {
+        case Crossing::Rising:
+            return firstCrossingSse2<Crossing::Rising>(values, count, level);
+        case Crossing::Falling:
+            return firstCrossingSse2<Crossing::Falling>(values, count, level);
+        case Crossing::Above:
+        default:
+            return firstCrossingSse2<Crossing::Above>(values, count, level);
+    }
+}
+
+// Lanes 0-1 in `low`, 2-3 in `high`, four values per step like the other versions
+void blockMomentsSse2(const double* values, int count, BlockMoments& moments)
+{
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d infinity = _mm_set1_pd(HUGE_VAL);
+    const __m128d minusInfinity = _mm_set1_pd(-HUGE_VAL);
+
+    __m128d numbersLow = _mm_setzero_pd(), numbersHigh = _mm_setzero_pd();
+    __m128d sumsLow = _mm_setzero_pd(), sumsHigh = _mm_setzero_pd();
+    __m128d squaresLow = _mm_setzero_pd(), squaresHigh = _mm_setzero_pd();
+    __m128d vMin = infinity;
+    __m128d vMax = minusInfinity;
+
+    // NaN lanes add zeros and leave the extremes alone
+    auto add = [&](const __m128d v, __m128d& numbers, __m128d& sums, __m128d& squares)
+    {
+        const __m128d isNumber = _mm_cmpord_pd(v, v);
+        const __m128d number = _mm_and_pd(isNumber, v);
+        numbers = _mm_add_pd(numbers, _mm_and_pd(isNumber, one));
+        sums = _mm_add_pd(sums, number);
+        squares = _mm_add_pd(squares, _mm_mul_pd(number, number));
+        vMin = _mm_min_pd(vMin, _mm_or_pd(number, _mm_andnot_pd(isNumber, infinity)));
+        vMax = _mm_max_pd(vMax, _mm_or_pd(number, _mm_andnot_pd(isNumber, minusInfinity)));
+    };
+
+    int i = 0;
+    for (; i + MomentLanes <= count; i += MomentLanes)
+    {
+        add(_mm_loadu_pd(values + i), numbersLow, sumsLow, squaresLow);
+        add(_mm_loadu_pd(values + i + 2), numbersHigh, sumsHigh, squaresHigh);
+    }
+
+    double numbers[MomentLanes], sums[MomentLanes], squares[MomentLanes], lanes[2];
+    _mm_storeu_pd(numbers, numbersLow);
+    _mm_storeu_pd(numbers + 2, numbersHigh);
+    _mm_storeu_pd(sums, sumsLow);
+    _mm_storeu_pd(sums + 2, sumsHigh);
+    _mm_storeu_pd(squares, squaresLow);
+    _mm_storeu_pd(squares + 2, squaresHigh);
+    _mm_storeu_pd(lanes, vMin);
+    double minVal = lanes[1] < lanes[0] ? lanes[1] : lanes[0];
+    _mm_storeu_pd(lanes, vMax);
+    double maxVal = lanes[1] > lanes[0] ? lanes[1] : lanes[0];
+    addMoments(values, i, count, numbers, sums, squares, minVal, maxVal);
+    storeMoments(numbers, sums, squares, minVal, maxVal, moments);
+    if (moments.count == 0)
+        return;
+
+    const __m128d mean = _mm_set1_pd(moments.sum / moments.count);
+    __m128d deviationsLow = _mm_setzero_pd(), deviationsHigh = _mm_setzero_pd();
+    auto addDeviation = [&mean](const __m128d v, __m128d& deviations)
+    {
+        const __m128d deviation = _mm_and_pd(_mm_cmpord_pd(v, v), _mm_sub_pd(v, mean));
+        deviations = _mm_add_pd(deviations, _mm_mul_pd(deviation, deviation));
+    };
+
+    int j = 0;
+    for (; j + MomentLanes <= count; j += MomentLanes)
+    {
+        addDeviation(_mm_loadu_pd(values + j), deviationsLow);
+        addDeviation(_mm_loadu_pd(values + j + 2), deviationsHigh);
+    }
+
+    double deviations[MomentLanes];
+    _mm_storeu_pd(deviations, deviationsLow);
+    _mm_storeu_pd(deviations + 2, deviationsHigh);
+    addDeviations(values, j, count, moments.sum / moments.count, deviations);
+    moments.m2 = combineLanes(deviations);
+}
+
+// AVX2
+
+QT_MODULE_TARGET_AVX2
+void minMaxIndexAvx2(const double* values, int count, int& minIdx, int& maxIdx)
+{
+    if (count < 16)
+    {
+        minMaxIndexScalar(values, count, minIdx, maxIdx);
+        return;
+    }
+
+    // Pass 1: minimum and maximum value
+    __m256d vMin = _mm256_loadu_pd(values);
+    __m256d vMax = vMin;
+    __m256d vNaN = _mm256_cmp_pd(vMin, vMin, _CMP_UNORD_Q);
+    int i = 4;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d v = _mm256_loadu_pd(values + i);
+        vMin = _mm256_min_pd(vMin, v);
+        vMax = _mm256_max_pd(vMax, v);
+        vNaN = _mm256_or_pd(vNaN, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, vMin);
+    double minVal = lanes[0];
+    for (int lane = 1; lane < 4; ++lane)
+        if (lanes[lane] < minVal) minVal = lanes[lane];
+    _mm256_storeu_pd(lanes, vMax);
+    double maxVal = lanes[0];
+    for (int lane = 1; lane < 4; ++lane)
+        if (lanes[lane] > maxVal) maxVal = lanes[lane];
+    bool hasNaN = _mm256_movemask_pd(vNaN) != 0;
+    for (; i < count; ++i)
+    {
+        hasNaN = hasNaN || std::isnan(values[i]);
+        if (values[i] < minVal) minVal = values[i];
+        if (values[i] > maxVal) maxVal = values[i];
+    }
+
+    // The min/max instructions order NaN differently from the scalar compares
+    if (hasNaN)
+    {
+        minMaxIndexScalar(values, count, minIdx, maxIdx);
+        return;
+    }
+
+    // Pass 2: the scalar loop keeps the first index holding each extreme
+    minIdx = -1;
+    maxIdx = -1;
+    const __m256d vMinVal = _mm256_set1_pd(minVal);
+    const __m256d vMaxVal = _mm256_set1_pd(maxVal);
+    int j = 0;
+    for (; j + 4 <= count && (minIdx < 0 || maxIdx < 0); j += 4)
+    {
+        const __m256d v = _mm256_loadu_pd(values + j);
+        if (minIdx < 0)
+        {
+            const int mask = _mm256_movemask_pd(_mm256_cmp_pd(v, vMinVal, _CMP_EQ_OQ));
+            if (mask != 0)
+                minIdx = j + firstLane(mask);
+        }
+        if (maxIdx < 0)
+        {
+            const int mask = _mm256_movemask_pd(_mm256_cmp_pd(v, vMaxVal, _CMP_EQ_OQ));
+            if (mask != 0)
+                maxIdx = j + firstLane(mask);
+        }
+    }
+    for (; j < count && (minIdx < 0 || maxIdx < 0); ++j)
+    {
+        if (minIdx < 0 && values[j] == minVal) minIdx = j;
+        if (maxIdx < 0 && values[j] == maxVal) maxIdx = j;
+    }
+}
+
+QT_MODULE_TARGET_AVX2
+int largestTriangleIndexAvx2(const double* times, const double* values, int count,
+                             double timeA, double valA, double avgX, double avgY)
+{
+    if (count < 8)
+        return largestTriangleIndexScalar(times, values, count, timeA, valA, avgX, avgY);
+
+    const double dxAvg = avgX - timeA;
+    const double dyAvg = avgY - valA;
+    const __m256d vDxAvg = _mm256_set1_pd(dxAvg);
+    const __m256d vDyAvg = _mm256_set1_pd(dyAvg);
+    const __m256d vTimeA = _mm256_set1_pd(timeA);
+    const __m256d vValA = _mm256_set1_pd(valA);
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d vStep = _mm256_set1_pd(4.0);
+
+    __m256d vBest = _mm256_set1_pd(-1.0);
+    __m256d vBestIdx = _mm256_setzero_pd();
+    __m256d vIdx = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+
+    int j = 0;
+    for (; j + 4 <= count; j += 4)
+    {
+        const __m256d t = _mm256_loadu_pd(times + j);
+        const __m256d v = _mm256_loadu_pd(values + j);
+        const __m256d cross = _mm256_sub_pd(_mm256_mul_pd(vDxAvg, _mm256_sub_pd(v, vValA)),
+                                            _mm256_mul_pd(_mm256_sub_pd(t, vTimeA), vDyAvg));
+        const __m256d area = _mm256_andnot_pd(signMask, cross);
+
+        // Strict compare per lane keeps the earliest index, like the scalar loop
+        const __m256d greater = _mm256_cmp_pd(area, vBest, _CMP_GT_OQ);
+        vBest = _mm256_blendv_pd(vBest, area, greater);
+        vBestIdx = _mm256_blendv_pd(vBestIdx, vIdx, greater);
+        vIdx = _mm256_add_pd(vIdx, vStep);
+    }
+
+    double best[4];
+    double bestIdx[4];
+    _mm256_storeu_pd(best, vBest);
+    _mm256_storeu_pd(bestIdx, vBestIdx);
+
+    double maxArea;
+    int maxAreaIdx;
+    reduceLanes(best, bestIdx, 4, maxArea, maxAreaIdx);
+
+    for (; j < count; ++j)
+    {
+        const double area = std::abs(dxAvg * (values[j] - valA) - (times[j] - timeA) * dyAvg);
+        if (area > maxArea)
+        {
+            maxArea = area;
+            maxAreaIdx = j;
+        }
+    }
+    return maxAreaIdx;
+}
+
+template <Crossing C>
+QT_MODULE_TARGET_AVX2
+int firstCrossingAvx2(const double* values, int count, double level)
+{
+    const __m256d vLevel = _mm256_set1_pd(level);
+    int i = C == Crossing::Above ? 0 : 1;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d v = _mm256_loadu_pd(values + i);
+        __m256d hit;
+        if constexpr (C == Crossing::Rising)
+            hit = _mm256_and_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i - 1), vLevel, _CMP_LT_OQ), _mm256_cmp_pd(v, vLevel, _CMP_GE_OQ));
+        else if constexpr (C == Crossing::Falling)
+            hit = _mm256_and_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i - 1), vLevel, _CMP_GT_OQ), _mm256_cmp_pd(v, vLevel, _CMP_LE_OQ));
+        else
+            hit = _mm256_cmp_pd(v, vLevel, _CMP_GE_OQ);
+
+        const int mask = _mm256_movemask_pd(hit);
+        if (mask != 0)
+            return i + firstLane(mask);
+    }
+    return firstCrossingFrom(values, i, count, level, C);
+}
+
+QT_MODULE_TARGET_AVX2
+int firstCrossingAvx2(const double* values, int count, double level, Crossing crossing)
+{
+    switch (crossing)
+    {
+        case Crossing::Rising:
+            return firstCrossingAvx2<Crossing::Rising>(values, count, level);
+        case Crossing::Falling:
+            return firstCrossingAvx2<Crossing::Falling>(values, count, level);
+        case Crossing::Above:
+        default:
+            return firstCrossingAvx2<Crossing::Above>(values, count, level);
+    }
+}
+
+QT_MODULE_TARGET_AVX2
+void blockMomentsAvx2(const double* values, int count, BlockMoments& moments)
+{
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d infinity = _mm256_set1_pd(HUGE_VAL);
+    const __m256d minusInfinity = _mm256_set1_pd(-HUGE_VAL);
+
+    __m256d vNumbers = _mm256_setzero_pd();
+    __m256d vSums = _mm256_setzero_pd();
+    __m256d vSquares = _mm256_setzero_pd();
+    __m256d vMin = infinity;
+    __m256d vMax = minusInfinity;
+
+    // NaN lanes add zeros and leave the extremes alone
+    int i = 0;
+    for (; i + MomentLanes <= count; i += MomentLanes)
+    {
+        const __m256d v = _mm256_loadu_pd(values + i);
+        const __m256d isNumber = _mm256_cmp_pd(v, v, _CMP_ORD_Q);
+        const __m256d number = _mm256_and_pd(isNumber, v);
+        vNumbers = _mm256_add_pd(vNumbers, _mm256_and_pd(isNumber, one));
+        vSums = _mm256_add_pd(vSums, number);
+        vSquares = _mm256_add_pd(vSquares, _mm256_mul_pd(number, number));
+        vMin = _mm256_min_pd(vMin, _mm256_blendv_pd(infinity, v, isNumber));
+        vMax = _mm256_max_pd(vMax, _mm256_blendv_pd(minusInfinity, v, isNumber));
+    }
+
+    double numbers[MomentLanes], sums[MomentLanes], squares[MomentLanes], lanes[MomentLanes];
+    _mm256_storeu_pd(numbers, vNumbers);
+    _mm256_storeu_pd(sums, vSums);
+    _mm256_storeu_pd(squares, vSquares);
+    _mm256_storeu_pd(lanes, vMin);
+    double minVal = lanes[0];
+    for (int lane = 1; lane < MomentLanes; ++lane)
+        if (lanes[lane] < minVal) minVal = lanes[lane];
+    _mm256_storeu_pd(lanes, vMax);
+    double maxVal = lanes[0];
+    for (int lane = 1; lane < MomentLanes; ++lane)
+        if (lanes[lane] > maxVal) maxVal = lanes[lane];
+    addMoments(values, i, count, numbers, sums, squares, minVal, maxVal);
+    storeMoments(numbers, sums, squares, minVal, maxVal, moments);
+    if (moments.count == 0)
+        return;
+
+    const __m256d mean = _mm256_set1_pd(moments.sum / moments.count);
+    __m256d vDeviations = _mm256_setzero_pd();
+    int j = 0;
+    for (; j + MomentLanes <= count; j += MomentLanes)
+    {
+        const __m256d v = _mm256_loadu_pd(values + j);
+        const __m256d deviation = _mm256_and_pd(_mm256_cmp_pd(v, v, _CMP_ORD_Q), _mm256_sub_pd(v, mean));
+        vDeviations = _mm256_add_pd(vDeviations, _mm256_mul_pd(deviation, deviation));
+    }
+
+    double deviations[MomentLanes];
+    _mm256_storeu_pd(deviations, vDeviations);
+    addDeviations(values, j, count, moments.sum / moments.count, deviations);
+    moments.m2 = combineLanes(deviations);
+}
+
+bool cpuHasAvx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    // AVX state must be enabled by the OS as well
+    __cpuid(info, 1);
+    const bool osXsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osXsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // QT_MODULE_X86_SIMD
+
+struct KernelTable
+{
+    void (*minMaxIndex)(const double*, int, int&, int&);
+    int (*largestTriangleIndex)(const double*, const double*, int, double, double, double, double);
+    int (*firstCrossing)(const double*, int, double, Crossing);
+    void (*blockMoments)(const double*, int, BlockMoments&);
+    const char* name;
+};
+
+KernelTable selectKernels()
+{
+#if defined(QT_MODULE_X86_SIMD)
+    if (cpuHasAvx2())
+        return {minMaxIndexAvx2, largestTriangleIndexAvx2, firstCrossingAvx2, blockMomentsAvx2, "AVX2"};
+    return {minMaxIndexSse2, largestTriangleIndexSse2, firstCrossingSse2, blockMomentsSse2, "SSE2"};
+#else
+    return {minMaxIndexScalar, largestTriangleIndexScalar, firstCrossingScalar, blockMomentsScalar, "scalar"};
+#endif
+}
+
+const KernelTable& kernels()
+{
+    static const KernelTable table = selectKernels();
+    return table;
+}
+
+}  // namespace
+
+void minMaxIndex(const double* values, int count, int& minIdx, int& maxIdx)
+{
+    kernels().minMaxIndex(values, count, minIdx, maxIdx);
+}
+
+int largestTriangleIndex(const double* times, const double* values, int count,
+                         double timeA, double valA, double avgX, double avgY)
+{
+    return kernels().largestTriangleIndex(times, values, count, timeA, valA, avgX, avgY);
+}
+
+int firstCrossing(const double* values, int count, double level, Crossing crossing)
+{
+    return kernels().firstCrossing(values, count, level, crossing);
+}
+
+void blockMoments(const double* values, int count, BlockMoments& moments)
+{
+    kernels().blockMoments(values, count, moments);
+}
+
+const char* instructionSet()
+{
+    return kernels().name;
+}
+
+}  // namespace Kernels
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,224 @@
+#include <opendaq_qt_module/spectrum_analyzer.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr double Pi = 3.14159265358979323846;
+constexpr double MaxOverlap = 0.95;
+
+// Periodic window (the DFT-even form), a sum of cosine terms
+void fillWindow(std::vector<double>& window, SpectrumWindow type)
+{
+    static const std::vector<double> Rectangular{1.0};
+    static const std::vector<double> Hann{0.5, 0.5};
+    static const std::vector<double> Hamming{0.54, 0.46};
+    static const std::vector<double> BlackmanHarris{0.35875, 0.48829, 0.14128, 0.01168};
+    static const std::vector<double> FlatTop{0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368};
+
+    const std::vector<double>* terms = &Rectangular;
+    switch (type)
+    {
+        case SpectrumWindow::Hann:
+            terms = &Hann;
+            break;
+        case SpectrumWindow::Hamming:
+            terms = &Hamming;
+            break;
+        case SpectrumWindow::BlackmanHarris:
+            terms = &BlackmanHarris;
+            break;
+        case SpectrumWindow::FlatTop:
+            terms = &FlatTop;
+            break;
+        default:
+            break;
+    }
+
+    const double size = static_cast<double>(window.size());
+    for (size_t i = 0; i < window.size(); ++i)
+    {
+        double value = 0.0;
+        double sign = 1.0;
+        for (size_t term = 0; term < terms->size(); ++term)
+        {
+            value += sign * (*terms)[term] * std::cos(2.0 * Pi * static_cast<double>(term * i) / size);
+            sign = -sign;
+        }
+        window[i] = value;
+    }
+}
+
+}  // namespace
+
+void SpectrumAnalyzer::configure(const SpectrumSettings& newSettings)
+{
+    SpectrumSettings normalized = newSettings;
+    normalized.fftSize = RealFft::supportedSize(normalized.fftSize);
+    normalized.overlap = std::clamp(normalized.overlap, 0.0, MaxOverlap);
+    normalized.averageCount = std::max(normalized.averageCount, 1);
+
+    if (fft && normalized == settings)
+        return;
+
+    settings = normalized;
+    prepare();
+}
+
+void SpectrumAnalyzer::prepare()
+{
+    const size_t size = settings.fftSize;
+    if (!fft || fft->size() != size)
+        fft = RealFft::plan(size);
+
+    hop = std::max<size_t>(1, static_cast<size_t>(std::lround(static_cast<double>(size) * (1.0 - settings.overlap))));
+
+    window.resize(size);
+    fillWindow(window, settings.window);
+
+    // Coherent gain: a sine of amplitude A shows |X| = A * sum(w) / 2 (A * sum(w) at DC and Nyquist)
+    double windowSum = 0.0;
+    for (double w : window)
+        windowSum += w;
+
+    const size_t binCount = fft->bins();
+    binScale.assign(binCount, 4.0 / (windowSum * windowSum));
+    binScale.front() = 1.0 / (windowSum * windowSum);
+    binScale.back() = 1.0 / (windowSum * windowSum);
+
+    block.resize(size);
+    windowed.resize(size);
+    transformed.resize(binCount);
+    latest.resize(binCount);
+    sum.resize(binCount);
+    averaged.resize(binCount);
+    reset();
+}
+
+void SpectrumAnalyzer::reset()
+{
+    filled = 0;
+    resetAverage();
+}
+
+void SpectrumAnalyzer::resetAverage()
+{
+    std::fill(sum.begin(), sum.end(), 0.0);
+    std::fill(averaged.begin(), averaged.end(), 0.0);
+    sumCount = 0;
+    averageComplete = false;
+    spectrumCount = 0;
+}
+
+size_t SpectrumAnalyzer::push(const double* values, size_t count, const SpectrumCallback& onSpectrum)
+{
+    if (!fft)
+        configure(settings);
+
+    const size_t size = block.size();
+    size_t spectra = 0;
+    while (count > 0)
+    {
+        const size_t take = std::min(count, size - filled);
+        std::memcpy(block.data() + filled, values, take * sizeof(double));
+        filled += take;
+        values += take;
+        count -= take;
+
+        if (filled < size)
+            break;
+
+        transformBlock();
+        accumulate();
+        ++spectra;
+        if (onSpectrum)
+            onSpectrum(averaged);
+
+        // The overlapping part starts the next block
+        const size_t keep = size - hop;
+        std::memmove(block.data(), block.data() + hop, keep * sizeof(double));
+        filled = keep;
+    }
+    return spectra;
+}
+
+void SpectrumAnalyzer::transformBlock()
+{
+    const size_t size = block.size();
+    for (size_t i = 0; i < size; ++i)
+        windowed[i] = block[i] * window[i];
+
+    fft->transform(windowed.data(), transformed.data());
+
+    for (size_t k = 0; k < transformed.size(); ++k)
+        latest[k] = std::norm(transformed[k]) * binScale[k];
+}
+
+void SpectrumAnalyzer::accumulate()
+{
+    const size_t binCount = latest.size();
+    const bool first = spectrumCount == 0;
+    ++spectrumCount;
+
+    switch (settings.averaging)
+    {
+        case SpectrumAveraging::None:
+            averaged = latest;
+            break;
+
+        case SpectrumAveraging::Linear:
+        {
+            for (size_t k = 0; k < binCount; ++k)
+                sum[k] += latest[k];
+            ++sumCount;
+
+            // The first average is shown while it builds up, later ones once complete
+            const bool complete = sumCount >= settings.averageCount;
+            if (complete || !averageComplete)
+            {
+                const double scale = 1.0 / static_cast<double>(sumCount);
+                for (size_t k = 0; k < binCount; ++k)
+                    averaged[k] = sum[k] * scale;
+            }
+            if (complete)
+            {
+                std::fill(sum.begin(), sum.end(), 0.0);
+                sumCount = 0;
+                averageComplete = true;
+            }
+            break;
+        }
+
+        case SpectrumAveraging::Exponential:
+        {
+            if (first)
+            {
+                averaged = latest;
+                break;
+            }
+            const double weight = 1.0 / static_cast<double>(settings.averageCount);
+            for (size_t k = 0; k < binCount; ++k)
+                averaged[k] += (latest[k] - averaged[k]) * weight;
+            break;
+        }
+
+        case SpectrumAveraging::PeakHold:
+            if (first)
+                averaged = latest;
+            else
+                for (size_t k = 0; k < binCount; ++k)
+                    averaged[k] = std::max(averaged[k], latest[k]);
+            break;
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,90 @@
+#include <opendaq_qt_module/spectrum_signal.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <algorithm>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+constexpr size_t MinReadBuffer = 200;  // Like the plotter's read buffers
+
+}  // namespace
+
+bool SpectrumSignal::read(bool analyse, const SpectrumAnalyzer::SpectrumCallback& onSpectrum)
+{
+    newSpectra = 0;
+    if (!streamReader.assigned())
+        return false;
+
+    // A read stops at an event; the samples behind it are read right away, not on the next wake-up
+    bool descriptorChanged = false;
+    for (;;)
+    {
+        const size_t available = streamReader.getAvailableCount();
+        if (readBuffer.size() < std::max(available, MinReadBuffer))
+            readBuffer.resize(std::max(available, MinReadBuffer));
+
+        daq::SizeT count = available;
+        daq::ReaderStatusPtr status;
+        streamReader.read(readBuffer.data(), &count, 0, &status);
+        if (analyse && count > 0)
+            newSpectra += analyzer.push(readBuffer.data(), count, onSpectrum);
+
+        daq::EventPacketPtr eventPacket;
+        if (status.assigned())
+            eventPacket = status.getEventPacket();
+        if (!eventPacket.assigned())
+            break;
+
+        if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+        {
+            applyDescriptors(eventPacket);
+            descriptorChanged = true;
+        }
+    }
+    return descriptorChanged;
+}
+
+void SpectrumSignal::applyDescriptors(const daq::EventPacketPtr& eventPacket)
+{
+    auto sig = inputPort.getSignal();
+    caption = sig.assigned() ? sig.getName().toStdString() : "N/A";
+
+    const DataDescriptorPtr descriptor = eventPacket.getParameters()[event_packet_param::DATA_DESCRIPTOR];
+    if (descriptor.assigned())
+    {
+        auto unit = descriptor.getUnit();
+        if (unit.assigned() && !unit.getSymbol().toStdString().empty())
+            caption += fmt::format(" [{}]", unit.getSymbol().toStdString());
+    }
+
+    // Bin frequencies follow from the sample rate of a linear domain
+    const DataDescriptorPtr domainDescriptor = eventPacket.getParameters()[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
+    if (domainDescriptor.assigned())
+    {
+        sampleRate = 0.0;
+        auto rule = domainDescriptor.getRule();
+        auto tickResolution = domainDescriptor.getTickResolution();
+        if (rule.assigned() && rule.getType() == DataRuleType::Linear && tickResolution.assigned())
+        {
+            const double delta = rule.getParameters().get("delta");
+            const double secondsPerTick = static_cast<double>(tickResolution.getNumerator()) /
+                                          static_cast<double>(tickResolution.getDenominator());
+            if (delta > 0.0 && secondsPerTick > 0.0)
+                sampleRate = 1.0 / (delta * secondsPerTick);
+        }
+    }
+
+    // Samples before and after the change do not belong in one spectrum
+    analyzer.reset();
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,137 @@
+#include <opendaq_qt_module/waterfall_image.h>
+#include <QPainter>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+struct ColorStop
+{
+    double position;
+    int red;
+    int green;
+    int blue;
+};
+
+}  // namespace
+
+ColorTable makeColorTable(ColorMap map)
+{
+    static const std::vector<ColorStop> Jet{
+        {0.0, 0, 0, 143}, {0.125, 0, 0, 255}, {0.375, 0, 255, 255}, {0.625, 255, 255, 0}, {0.875, 255, 0, 0}, {1.0, 128, 0, 0}};
+    static const std::vector<ColorStop> Inferno{
+        {0.0, 0, 0, 4}, {0.25, 87, 16, 110}, {0.5, 188, 55, 84}, {0.75, 249, 142, 9}, {1.0, 252, 255, 164}};
+    static const std::vector<ColorStop> Grayscale{{0.0, 0, 0, 0}, {1.0, 255, 255, 255}};
+
+    const std::vector<ColorStop>& stops = map == ColorMap::Inferno ? Inferno : map == ColorMap::Grayscale ? Grayscale : Jet;
+
+    ColorTable table;
+    size_t stop = 0;
+    for (size_t level = 0; level < table.size(); ++level)
+    {
+        const double position = static_cast<double>(level) / static_cast<double>(table.size() - 1);
+        while (stop + 2 < stops.size() && position > stops[stop + 1].position)
+            ++stop;
+
+        const ColorStop& from = stops[stop];
+        const ColorStop& to = stops[stop + 1];
+        const double t = std::clamp((position - from.position) / (to.position - from.position), 0.0, 1.0);
+        auto mix = [t](int a, int b) { return static_cast<int>(std::lround(a + (b - a) * t)); };
+        table[level] = qRgb(mix(from.red, to.red), mix(from.green, to.green), mix(from.blue, to.blue));
+    }
+    return table;
+}
+
+void WaterfallImage::resize(int width, int rows)
+{
+    if (width == image.width() && rows == image.height())
+        return;
+
+    image = width > 0 && rows > 0 ? QImage(width, rows, QImage::Format_RGB32) : QImage();
+    clear();
+}
+
+void WaterfallImage::clear()
+{
+    if (!image.isNull())
+        image.fill(Qt::black);
+    newest = 0;
+}
+
+void WaterfallImage::addRow(const QRgb* pixels)
+{
+    if (image.isNull())
+        return;
+
+    // The oldest row is the one below the wrap point; it becomes the newest
+    newest = (newest + image.height() - 1) % image.height();
+    std::memcpy(image.scanLine(newest), pixels, static_cast<size_t>(image.width()) * sizeof(QRgb));
+}
+
+void WaterfallImage::draw(QPainter& painter, const QRectF& target) const
+{
+    if (image.isNull())
+        return;
+
+    // Image rows [newest, rows) are the newer part, [0, newest) the older part below it
+    const double rowHeight = target.height() / image.height();
+    const int newerRows = image.height() - newest;
+
+    const QRectF newerTarget(target.left(), target.top(), target.width(), newerRows * rowHeight);
+    painter.drawImage(newerTarget, image, QRectF(0, newest, image.width(), newerRows));
+
+    if (newest > 0)
+    {
+        const QRectF olderTarget(target.left(), newerTarget.bottom(), target.width(), newest * rowHeight);
+        painter.drawImage(olderTarget, image, QRectF(0, 0, image.width(), newest));
+    }
+}
+
+void WaterfallRowQueue::reset(int width, int rowCapacity)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    rowWidth = std::max(width, 0);
+    capacity = std::max(rowCapacity, 0);
+    rows.resize(static_cast<size_t>(rowWidth) * static_cast<size_t>(capacity));
+    first = 0;
+    count = 0;
+}
+
+void WaterfallRowQueue::push(const QRgb* row, int width)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (width != rowWidth || capacity == 0)
+        return;
+
+    // Full: the oldest row goes
+    if (count == capacity)
+    {
+        first = (first + 1) % capacity;
+        --count;
+    }
+
+    const size_t index = static_cast<size_t>((first + count) % capacity);
+    std::memcpy(rows.data() + index * static_cast<size_t>(rowWidth), row, static_cast<size_t>(rowWidth) * sizeof(QRgb));
+    ++count;
+}
+
+void WaterfallRowQueue::drain(WaterfallImage& image)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (image.width() == rowWidth)
+        for (int i = 0; i < count; ++i)
+            image.addRow(rows.data() + static_cast<size_t>((first + i) % capacity) * static_cast<size_t>(rowWidth));
+    first = 0;
+    count = 0;
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
@@ -0,0 +1,152 @@
+#include <opendaq_qt_module/worker_pool.h>
+#include <algorithm>
+
+BEGIN_NAMESPACE_OPENDAQ_QT_MODULE
+
+namespace QtPlotter
+{
+
+namespace
+{
+
+// Per-signal work stops scaling well beyond this; leave the remaining cores to the application
+constexpr size_t MaxConcurrency = 8;
+
+}  // namespace
+
+std::shared_ptr<WorkerPool> WorkerPool::shared()
+{
+    // Owned by its users rather than a static, so the threads are joined
+    // when the last plotter goes away and not while the module is unloaded
+    static std::mutex sharedMutex;
+    static std::weak_ptr<WorkerPool> sharedPool;
+
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    auto pool = sharedPool.lock();
+    if (!pool)
+    {
+        const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        pool = std::make_shared<WorkerPool>(std::min(hardwareThreads, MaxConcurrency) - 1);
+        sharedPool = pool;
+    }
+    return pool;
+}
+
+WorkerPool::WorkerPool(size_t threadCount)
+{
+    workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+        workers.emplace_back(&WorkerPool::workerLoop, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void WorkerPool::parallelFor(size_t count, const std::function<void(size_t)>& task)
+{
+    if (count == 0)
+        return;
+
+    // Nothing to share: skip the handoff
+    if (count == 1 || workers.empty())
+    {
+        for (size_t i = 0; i < count; ++i)
+            task(i);
+        return;
+    }
+
+    Job job;
+    job.task = &task;
+    job.count = count;
+    job.remaining = count;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    jobs.push_back(&job);
+    workAvailable.notify_all();
+
+    // The caller works on its own job until all indices are handed out
+    size_t index;
+    while (claim(job, index))
+    {
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+            task(index);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        finish(job, error);
+    }
+
+    jobFinished.wait(lock, [&job]() { return job.remaining == 0; });
+
+    if (job.error)
+        std::rethrow_exception(job.error);
+}
+
+bool WorkerPool::claim(Job& job, size_t& index)
+{
+    if (job.next >= job.count)
+        return false;
+
+    index = job.next++;
+    if (job.next == job.count)
+        jobs.erase(std::find(jobs.begin(), jobs.end(), &job));
+    return true;
+}
+
+void WorkerPool::finish(Job& job, std::exception_ptr error)
+{
+    if (error && !job.error)
+        job.error = error;
+
+    // The job lives on its caller's stack; it must not be touched after the last index
+    if (--job.remaining == 0)
+        jobFinished.notify_all();
+}
+
+void WorkerPool::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        workAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+        if (stopping)
+            break;
+
+        Job& job = *jobs.front();
+        size_t index;
+        if (!claim(job, index))
+            continue;
+
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+            (*job.task)(index);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        finish(job, error);
+    }
+}
+
+}  // namespace QtPlotter
+
+END_NAMESPACE_OPENDAQ_QT_MODULE
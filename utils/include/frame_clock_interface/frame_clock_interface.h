@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QObject>
+#include <QVariant>
+
+// Contract of the application-wide frame clock, shared by the GUI and by widget
+// modules that do not link against it.
+// The clock is published as a QObject in the application property below and has
+// these invokable methods:
+//   registerView(QObject* view, int priority, int intervalMs)  - intervalMs 0: only on requestFrame
+//   unregisterView(QObject* view)
+//   requestFrame(QObject* view)                                 - from any thread with Qt::QueuedConnection
+// In every frame, due views receive a FrameEvent in priority order until the frame budget is spent.
+namespace FrameClockInterface
+{
+    constexpr const char* ApplicationProperty = "openDAQFrameClock";
+    constexpr QEvent::Type FrameEvent = static_cast<QEvent::Type>(QEvent::User + 0x0FC);
+
+    enum Priority
+    {
+        Low = 0,      // Periodic status widgets
+        Normal = 50,  // Live plots
+        High = 100
+    };
+
+    // The clock, or nullptr if the application does not provide one
+    inline QObject* clock()
+    {
+        if (!QCoreApplication::instance())
+            return nullptr;
+        return QCoreApplication::instance()->property(ApplicationProperty).value<QObject*>();
+    }
+}